@@ -12,7 +12,10 @@
 #include <ossia/detail/algorithms.hpp>
 
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonValue>
@@ -30,12 +33,15 @@ extern "C" score::Plugin_QtInterface* plugin_instance();
 class DLL
 {
 public:
-  explicit DLL(const char* const so) noexcept
+  explicit DLL(const char* const so, bool lazy = false) noexcept
   {
 #ifdef _WIN32
     impl = (void*)LoadLibraryA(so);
 #else
-    impl = dlopen(so, RTLD_GLOBAL | RTLD_NOW | RTLD_NODELETE);
+    // Lazy binding is only for the plug-ins shipped with a release, which
+    // are known to link correctly: a third-party plug-in with a missing symbol
+    // has to fail here rather than crash when the symbol is first used
+    impl = dlopen(so, RTLD_GLOBAL | (lazy ? RTLD_LAZY : RTLD_NOW) | RTLD_NODELETE);
 #endif
   }
 
@@ -119,6 +125,24 @@ QStringList pluginsDir()
   return l;
 }
 
+static bool isBundled(const QString& fileName)
+{
+#if defined(SCORE_DEPLOYMENT_BUILD)
+  // The plug-ins of the release are in the folders relative to the executable
+  const auto app = QCoreApplication::applicationDirPath();
+  const auto dir = QFileInfo{fileName}.canonicalPath();
+  for(const auto& path : pluginsDir())
+  {
+    if(!path.startsWith(app))
+      continue;
+    if(const auto bundled = QDir{path}.canonicalPath();
+       !bundled.isEmpty() && dir == bundled)
+      return true;
+  }
+#endif
+  return false;
+}
+
 QStringList addonsDir()
 {
   QStringList l;
@@ -142,6 +166,24 @@ QStringList pluginsWhitelist()
   return s.value("PluginSettings/Whitelist", QStringList{}).toStringList();
 }
 
+bool reportLoadingTimes() noexcept
+{
+  static const bool report = qEnvironmentVariableIsSet("SCORE_PLUGIN_TIMINGS");
+  return report;
+}
+
+/**
+ * Files of the plug-in folders which turned out not to be score plug-ins
+ * are remembered along with their size and date, so that they are not
+ * opened again at the next startup unless they change.
+ */
+static QString notAPluginSignature(const QFileInfo& file)
+{
+  return QString::number(file.size()) + ":"
+         + QString::number(file.lastModified().toMSecsSinceEpoch()) + ":"
+         + file.absoluteFilePath();
+}
+
 static bool isBlacklisted(const QString& str)
 {
 #if !defined(__EMSCRIPTEN__)
@@ -172,7 +214,7 @@ loadPlugin(const QString& fileName, const std::vector<score::Addon>& availablePl
   }
 
   static std::vector<DLL> plugins;
-  DLL ptr{fileName.toUtf8().constData()};
+  DLL ptr{fileName.toUtf8().constData(), isBundled(fileName)};
 
   if(ptr)
   {
@@ -225,14 +267,31 @@ void loadPluginsInAllFolders(
   using namespace score::PluginLoader;
 
 #if !defined(QT_STATIC) && !defined(__EMSCRIPTEN__)
+  QSettings s;
+  const QStringList knownNotPlugins
+      = s.value("PluginSettings/NotPlugins", QStringList{}).toStringList();
+  QStringList notPlugins;
+
   // Load dynamic plug-ins
   for(const QString& pluginsFolder : pluginsDir() + additional)
   {
     QDir pluginsDir(pluginsFolder);
-    for(const QString& fileName : pluginsDir.entryList(QDir::Files))
+    for(const QFileInfo& file : pluginsDir.entryInfoList(QDir::Files))
     {
-      auto path = pluginsDir.absoluteFilePath(fileName);
+      auto signature = notAPluginSignature(file);
+      if(knownNotPlugins.contains(signature))
+      {
+        notPlugins.push_back(std::move(signature));
+        continue;
+      }
+
+      auto path = file.absoluteFilePath();
+
+      QElapsedTimer timer;
+      timer.start();
       auto plug = loadPlugin(path, availablePlugins);
+      if(reportLoadingTimes())
+        qDebug() << "Plug-in" << path << "opened in" << timer.elapsed() << "ms";
 
       switch(plug.second)
       {
@@ -245,11 +304,18 @@ void loadPluginsInAllFolders(
           availablePlugins.push_back(std::move(addon));
           break;
         }
+        case PluginLoadingError::NotAPlugin: {
+          notPlugins.push_back(std::move(signature));
+          break;
+        }
         default:
           break;
       }
     }
   }
+
+  if(notPlugins != knownNotPlugins)
+    s.setValue("PluginSettings/NotPlugins", notPlugins);
 #endif
 }
 
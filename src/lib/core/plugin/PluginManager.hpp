@@ -12,6 +12,8 @@
 
 #include <core/plugin/PluginDependencyGraph.hpp>
 
+#include <QDebug>
+#include <QElapsedTimer>
 #include <QString>
 #include <QStringList>
 
@@ -44,6 +46,10 @@ enum class PluginLoadingError
 QStringList addonsDir();
 QStringList pluginsDir();
 
+//! Set the SCORE_PLUGIN_TIMINGS environment variable to print the time taken
+//! by each plug-in at startup
+SCORE_LIB_BASE_EXPORT bool reportLoadingTimes() noexcept;
+
 SCORE_LIB_BASE_EXPORT void loadPluginsInAllFolders(
     std::vector<score::Addon>& availablePlugins, QStringList additional = {});
 
@@ -65,6 +71,9 @@ void registerPluginsImpl(
   // Load what the plug-ins have to offer.
   for(const score::Addon& addon : availablePlugins)
   {
+    QElapsedTimer timer;
+    timer.start();
+
     auto commands_plugin = dynamic_cast<CommandFactory_QtInterface*>(addon.plugin);
     if(commands_plugin)
     {
@@ -93,6 +102,10 @@ void registerPluginsImpl(
         }
       }
     }
+
+    if(reportLoadingTimes())
+      qDebug() << "Plug-in" << score::uuids::toByteArray(addon.key.impl())
+               << "registered its factories in" << timer.elapsed() << "ms";
   }
 }
 
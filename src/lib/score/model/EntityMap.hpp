@@ -58,6 +58,7 @@ public:
   mutable Nano::Signal<void(const T&)> removing;
   mutable Nano::Signal<void(const T&)> removed;
   mutable Nano::Signal<void()> orderChanged;
+  mutable Nano::Signal<void()> replacing;
   mutable Nano::Signal<void()> replaced;
 
   void add(T* t) INLINE_EXPORT { EntityMapInserter<T, Ordered>{}.add(*this, t); }
@@ -118,6 +119,10 @@ public:
 
   void replace(IdContainer<T, T, Ordered>&& new_map)
   {
+    // Sent once instead of a removing() per element:
+    // the elements are still alive when it is received
+    replacing();
+
     for(T& m : m_map)
       delete &m;
 
@@ -13,14 +13,19 @@
 #include <QSize>
 #include <QSizeF>
 #include <QString>
+#include <QSysInfo>
 #include <QVariant>
 #include <QVector2D>
 #include <QVector3D>
 #include <QVector4D>
 #include <QtContainerFwd>
+#include <QtEndian>
 
 #include <score_lib_base_export.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -204,6 +209,153 @@ DATASTREAM_QT_BUILTIN(QColor)
 DATASTREAM_QT_BUILTIN(QVariant)
 DATASTREAM_QT_BUILTIN(std::string)
 
+/**
+ * Contiguous arrays of these types are written and read with a single raw
+ * access to the device instead of one QDataStream call per element.
+ * The data is converted to the stream's byte order so that the result is
+ * byte-for-byte identical to the element-wise serialization.
+ */
+template <typename T>
+concept is_DataStreamBulkSerializable
+    = (std::is_integral_v<T> && !std::is_same_v<T, bool>
+       && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+      || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+namespace score::serialization
+{
+template <std::size_t N>
+struct bulk_uint;
+template <>
+struct bulk_uint<1>
+{
+  using type = quint8;
+};
+template <>
+struct bulk_uint<2>
+{
+  using type = quint16;
+};
+template <>
+struct bulk_uint<4>
+{
+  using type = quint32;
+};
+template <>
+struct bulk_uint<8>
+{
+  using type = quint64;
+};
+
+template <typename T>
+void writeBulk(QDataStream& s, const T* data, std::size_t n)
+{
+  if constexpr(std::is_same_v<T, float>)
+  {
+    // QDataStream writes floats as doubles unless asked otherwise
+    if(s.floatingPointPrecision() == QDataStream::DoublePrecision)
+    {
+      std::array<double, 512> buf;
+      for(std::size_t i = 0; i < n; i += buf.size())
+      {
+        const std::size_t count = std::min(buf.size(), n - i);
+        std::copy_n(data + i, count, buf.data());
+        writeBulk(s, buf.data(), count);
+      }
+      return;
+    }
+  }
+  else if constexpr(std::is_same_v<T, double>)
+  {
+    // ... and doubles as floats if asked to
+    if(s.floatingPointPrecision() == QDataStream::SinglePrecision)
+    {
+      std::array<float, 512> buf;
+      for(std::size_t i = 0; i < n; i += buf.size())
+      {
+        const std::size_t count = std::min(buf.size(), n - i);
+        std::copy_n(data + i, count, buf.data());
+        writeBulk(s, buf.data(), count);
+      }
+      return;
+    }
+  }
+
+  using U = typename bulk_uint<sizeof(T)>::type;
+  const bool native = sizeof(T) == 1
+                      || (QSysInfo::ByteOrder == QSysInfo::BigEndian)
+                             == (s.byteOrder() == QDataStream::BigEndian);
+  if(native)
+  {
+    s.writeRawData(reinterpret_cast<const char*>(data), n * sizeof(T));
+    return;
+  }
+
+  std::array<U, 512> buf;
+  for(std::size_t i = 0; i < n; i += buf.size())
+  {
+    const std::size_t count = std::min(buf.size(), n - i);
+    if(s.byteOrder() == QDataStream::BigEndian)
+      qToBigEndian<U>(data + i, count, buf.data());
+    else
+      qToLittleEndian<U>(data + i, count, buf.data());
+    s.writeRawData(reinterpret_cast<const char*>(buf.data()), count * sizeof(T));
+  }
+}
+
+template <typename T>
+void readBulk(QDataStream& s, T* data, std::size_t n)
+{
+  if constexpr(std::is_same_v<T, float>)
+  {
+    if(s.floatingPointPrecision() == QDataStream::DoublePrecision)
+    {
+      std::array<double, 512> buf;
+      for(std::size_t i = 0; i < n; i += buf.size())
+      {
+        const std::size_t count = std::min(buf.size(), n - i);
+        readBulk(s, buf.data(), count);
+        std::copy_n(buf.data(), count, data + i);
+      }
+      return;
+    }
+  }
+  else if constexpr(std::is_same_v<T, double>)
+  {
+    if(s.floatingPointPrecision() == QDataStream::SinglePrecision)
+    {
+      std::array<float, 512> buf;
+      for(std::size_t i = 0; i < n; i += buf.size())
+      {
+        const std::size_t count = std::min(buf.size(), n - i);
+        readBulk(s, buf.data(), count);
+        std::copy_n(buf.data(), count, data + i);
+      }
+      return;
+    }
+  }
+
+  using U = typename bulk_uint<sizeof(T)>::type;
+  const auto bytes = n * sizeof(T);
+  if(s.readRawData(reinterpret_cast<char*>(data), bytes) != qint64(bytes))
+  {
+    s.setStatus(QDataStream::ReadPastEnd);
+    std::memset(reinterpret_cast<char*>(data), 0, bytes);
+    return;
+  }
+
+  const bool native = sizeof(T) == 1
+                      || (QSysInfo::ByteOrder == QSysInfo::BigEndian)
+                             == (s.byteOrder() == QDataStream::BigEndian);
+  if(!native)
+  {
+    if(s.byteOrder() == QDataStream::BigEndian)
+      qFromBigEndian<U>(data, n, data);
+    else
+      qFromLittleEndian<U>(data, n, data);
+  }
+}
+}
+
 template <typename T>
 DataStreamInput& operator<<(DataStreamInput& s, const QList<T>& obj) = delete;
 template <typename T>
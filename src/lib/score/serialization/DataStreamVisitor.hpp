@@ -564,8 +564,15 @@ struct TSerializer<DataStream, std::vector<T, Alloc>>
   static void readFrom(DataStream::Serializer& s, const std::vector<T, Alloc>& vec)
   {
     s.stream() << (int32_t)vec.size();
-    for(const auto& elt : vec)
-      s.stream() << elt;
+    if constexpr(is_DataStreamBulkSerializable<T>)
+    {
+      score::serialization::writeBulk(s.stream().stream, vec.data(), vec.size());
+    }
+    else
+    {
+      for(const auto& elt : vec)
+        s.stream() << elt;
+    }
 
     SCORE_DEBUG_INSERT_DELIMITER2(s);
   }
@@ -577,9 +584,16 @@ struct TSerializer<DataStream, std::vector<T, Alloc>>
 
     vec.clear();
     vec.resize(n);
-    for(int32_t i = 0; i < n; i++)
+    if constexpr(is_DataStreamBulkSerializable<T>)
+    {
+      score::serialization::readBulk(s.stream().stream, vec.data(), vec.size());
+    }
+    else
     {
-      s.stream() >> vec[i];
+      for(int32_t i = 0; i < n; i++)
+      {
+        s.stream() >> vec[i];
+      }
     }
 
     SCORE_DEBUG_CHECK_DELIMITER2(s);
@@ -594,8 +608,15 @@ struct TSerializer<DataStream, boost::container::vector<T, Alloc>>
   readFrom(DataStream::Serializer& s, const boost::container::vector<T, Alloc>& vec)
   {
     s.stream() << (int32_t)vec.size();
-    for(const auto& elt : vec)
-      s.stream() << elt;
+    if constexpr(is_DataStreamBulkSerializable<T>)
+    {
+      score::serialization::writeBulk(s.stream().stream, vec.data(), vec.size());
+    }
+    else
+    {
+      for(const auto& elt : vec)
+        s.stream() << elt;
+    }
 
     SCORE_DEBUG_INSERT_DELIMITER2(s);
   }
@@ -608,9 +629,16 @@ struct TSerializer<DataStream, boost::container::vector<T, Alloc>>
 
     vec.clear();
     vec.resize(n);
-    for(int32_t i = 0; i < n; i++)
+    if constexpr(is_DataStreamBulkSerializable<T>)
+    {
+      score::serialization::readBulk(s.stream().stream, vec.data(), vec.size());
+    }
+    else
     {
-      s.stream() >> vec[i];
+      for(int32_t i = 0; i < n; i++)
+      {
+        s.stream() >> vec[i];
+      }
     }
 
     SCORE_DEBUG_CHECK_DELIMITER2(s);
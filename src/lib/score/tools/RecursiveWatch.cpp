@@ -1,7 +1,20 @@
 #include <score/tools/RecursiveWatch.hpp>
+#include <score/tools/ThreadPool.hpp>
 
+#include <ossia/detail/hash_map.hpp>
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <iostream>
+#include <mutex>
 
 #if __has_include(<version>)
 #include <version>
@@ -214,20 +227,462 @@ void RecursiveWatch::scan() const
     return;
 #endif
 
-  for_all_files(m_root, [this](std::string_view path) {
-    if(path.empty())
+  for_all_files(m_root, [this](std::string_view path) { dispatch(path); });
+}
+
+void RecursiveWatch::dispatch(std::string_view path) const
+{
+  if(path.empty())
+    return;
+  if(auto last_dot = path.find_last_of('.'); last_dot < path.size() - 1)
+  {
+    std::string_view suffix = path.substr(last_dot + 1);
+    if(auto it = m_watched.find(suffix); it != m_watched.end())
+    {
+      for(auto& handler : it->second)
+        handler.added(path);
+    }
+  }
+}
+
+namespace
+{
+struct indexed_file
+{
+  int64_t mtime{};
+
+  // Handler id -> metadata returned by its describe callback
+  std::vector<std::pair<std::string, std::string>> metadata;
+
+  const std::string* find(std::string_view id) const noexcept
+  {
+    for(const auto& [k, v] : metadata)
+      if(k == id)
+        return &v;
+    return nullptr;
+  }
+};
+
+struct indexed_folder
+{
+  int64_t mtime{};
+
+  // Names of the matching files and of the sub-folders
+  std::vector<std::string> files;
+  std::vector<std::string> folders;
+};
+
+struct library_index
+{
+  // The extensions which were watched when the folders were listed
+  std::vector<std::string> extensions;
+  ossia::hash_map<std::string, indexed_folder> folders;
+  ossia::hash_map<std::string, indexed_file> files;
+};
+
+constexpr quint32 index_magic = 0x53434c49;
+constexpr quint32 index_version = 2;
+
+void writeString(QDataStream& s, const std::string& str)
+{
+  s << QByteArray::fromRawData(str.data(), str.size());
+}
+
+std::string readString(QDataStream& s)
+{
+  QByteArray b;
+  s >> b;
+  return b.toStdString();
+}
+
+library_index loadIndex(const std::string& file)
+{
+  QFile f{QString::fromStdString(file)};
+  if(!f.open(QIODevice::ReadOnly))
+    return {};
+
+  QDataStream s{&f};
+  quint32 magic{}, version{};
+  s >> magic >> version;
+  if(magic != index_magic || version != index_version)
+    return {};
+
+  library_index index;
+  const auto ok = [&s] { return s.status() == QDataStream::Ok; };
+  quint32 count{};
+
+  s >> count;
+  for(quint32 i = 0; i < count && ok(); i++)
+    index.extensions.push_back(readString(s));
+
+  s >> count;
+  for(quint32 i = 0; i < count && ok(); i++)
+  {
+    auto path = readString(s);
+    indexed_folder folder;
+    qint64 mtime{};
+    quint32 n{};
+    s >> mtime >> n;
+    folder.mtime = mtime;
+    for(quint32 k = 0; k < n && ok(); k++)
+      folder.files.push_back(readString(s));
+    s >> n;
+    for(quint32 k = 0; k < n && ok(); k++)
+      folder.folders.push_back(readString(s));
+    index.folders.emplace(std::move(path), std::move(folder));
+  }
+
+  s >> count;
+  for(quint32 i = 0; i < count && ok(); i++)
+  {
+    auto path = readString(s);
+    indexed_file file;
+    qint64 mtime{};
+    quint32 n{};
+    s >> mtime >> n;
+    file.mtime = mtime;
+    for(quint32 k = 0; k < n && ok(); k++)
+    {
+      auto id = readString(s);
+      file.metadata.emplace_back(std::move(id), readString(s));
+    }
+    index.files.emplace(std::move(path), std::move(file));
+  }
+
+  // A truncated or corrupted index is ignored
+  if(!ok())
+    return {};
+  return index;
+}
+
+void saveIndex(const std::string& file, const library_index& index)
+{
+  // Written to a temporary file then renamed:
+  // the index is never read while partially written
+  QSaveFile f{QString::fromStdString(file)};
+  if(!f.open(QIODevice::WriteOnly))
+    return;
+
+  QDataStream s{&f};
+  s << index_magic << index_version;
+
+  s << quint32(index.extensions.size());
+  for(const auto& ext : index.extensions)
+    writeString(s, ext);
+
+  s << quint32(index.folders.size());
+  for(const auto& [path, folder] : index.folders)
+  {
+    writeString(s, path);
+    s << qint64(folder.mtime) << quint32(folder.files.size());
+    for(const auto& name : folder.files)
+      writeString(s, name);
+    s << quint32(folder.folders.size());
+    for(const auto& name : folder.folders)
+      writeString(s, name);
+  }
+
+  s << quint32(index.files.size());
+  for(const auto& [path, file] : index.files)
+  {
+    writeString(s, path);
+    s << qint64(file.mtime) << quint32(file.metadata.size());
+    for(const auto& [id, metadata] : file.metadata)
+    {
+      writeString(s, id);
+      writeString(s, metadata);
+    }
+  }
+
+  f.commit();
+}
+
+// Scans may overlap when the library is rescanned:
+// only the index of the most recent one is kept
+std::mutex& indexMutex()
+{
+  static std::mutex m;
+  return m;
+}
+uint64_t g_lastScan{};
+uint64_t g_lastSavedScan{};
+
+int64_t modificationTime(std::string_view path)
+{
+  const QFileInfo info{QString::fromUtf8(path.data(), path.size())};
+  return info.exists() ? info.lastModified().toMSecsSinceEpoch() : -1;
+}
+
+using main_thread_tasks = std::vector<std::function<void()>>;
+
+struct pending_file
+{
+  std::string path;
+
+  // The handlers for which the file has to be read
+  std::vector<const RecursiveWatch::Callbacks*> handlers;
+};
+
+struct scan_job : std::enable_shared_from_this<scan_job>
+{
+  std::string root;
+  std::string indexFile;
+  ossia::string_map<std::vector<RecursiveWatch::Callbacks>> watched;
+  std::weak_ptr<bool> alive;
+  uint64_t generation{};
+
+  library_index previous;
+  library_index current;
+  bool reuseFolders{};
+
+  std::vector<pending_file> pending;
+  main_thread_tasks cached;
+
+  // Guards current.files and the count of running worker tasks
+  std::mutex mutex;
+  std::condition_variable done;
+  int running{};
+
+  const std::vector<RecursiveWatch::Callbacks>* handlers(std::string_view path) const
+  {
+    auto last_dot = path.find_last_of('.');
+    if(last_dot == path.npos || last_dot == path.size() - 1)
+      return nullptr;
+    if(auto it = watched.find(path.substr(last_dot + 1)); it != watched.end())
+      return &it->second;
+    return nullptr;
+  }
+
+  bool expired() const noexcept { return alive.expired(); }
+
+  void run()
+  {
+    if(!indexFile.empty())
+      previous = loadIndex(indexFile);
+
+    for(const auto& [ext, cbs] : watched)
+      current.extensions.push_back(ext);
+    std::sort(current.extensions.begin(), current.extensions.end());
+
+    // If other extensions are watched, the folders have to be listed again
+    reuseFolders = previous.extensions == current.extensions;
+
+    std::string folder = root;
+    while(folder.size() > 1 && folder.back() == '/')
+      folder.pop_back();
+    walk(folder);
+    if(expired())
+      return;
+
+    // The unchanged files are loaded from the index right away
+    post(std::move(cached));
+
+    readPending();
+    if(expired() || indexFile.empty())
+      return;
+
+    std::lock_guard lock{indexMutex()};
+    if(generation > g_lastSavedScan)
+    {
+      saveIndex(indexFile, current);
+      g_lastSavedScan = generation;
+    }
+  }
+
+  void walk(const std::string& path)
+  {
+    if(expired())
+      return;
+
+    indexed_folder folder;
+    folder.mtime = modificationTime(path);
+    if(folder.mtime < 0)
+      return;
+
+    // Adding, removing or renaming an entry changes the date of its folder:
+    // the content of a folder which did not change is known from the index
+    auto prev = previous.folders.find(path);
+    if(reuseFolders && prev != previous.folders.end()
+       && prev->second.mtime == folder.mtime)
+    {
+      folder.files = prev->second.files;
+      folder.folders = prev->second.folders;
+    }
+    else
+    {
+      list(path, folder);
+    }
+
+    for(const auto& name : folder.files)
+      visit(path + '/' + name);
+
+    const auto subfolders = folder.folders;
+    current.folders.emplace(path, std::move(folder));
+    for(const auto& name : subfolders)
+      walk(path + '/' + name);
+  }
+
+  void list(const std::string& path, indexed_folder& folder) const
+  {
+    // Hidden files and folders (.git, etc) are not listed
+    const QDir dir{QString::fromStdString(path)};
+    const auto entries
+        = dir.entryInfoList(QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot);
+    for(const auto& info : entries)
+    {
+      auto name = info.fileName().toStdString();
+      if(info.isDir())
+      {
+        // Links to a parent folder would be followed forever
+        if(info.isSymLink()
+           && dir.canonicalPath().startsWith(info.canonicalFilePath()))
+          continue;
+        folder.folders.push_back(std::move(name));
+      }
+      else if(handlers(name))
+      {
+        folder.files.push_back(std::move(name));
+      }
+    }
+  }
+
+  void visit(const std::string& path)
+  {
+    auto hdl = handlers(path);
+    if(!hdl)
       return;
-    if(auto last_dot = path.find_last_of('.'); last_dot < path.size() - 1)
+
+    indexed_file file;
+    file.mtime = modificationTime(path);
+    if(file.mtime < 0)
+      return;
+
+    auto prev = previous.files.find(path);
+    const bool unchanged
+        = prev != previous.files.end() && prev->second.mtime == file.mtime;
+
+    pending_file todo{path, {}};
+    for(const auto& handler : *hdl)
+    {
+      if(unchanged && handler.describe && handler.load)
+      {
+        if(auto metadata = prev->second.find(handler.id))
+        {
+          file.metadata.emplace_back(handler.id, *metadata);
+          if(!metadata->empty())
+            cached.push_back(
+                [f = handler.load, path, m = *metadata] { f(path, m); });
+          continue;
+        }
+      }
+      todo.handlers.push_back(&handler);
+    }
+
+    current.files.emplace(path, std::move(file));
+    if(!todo.handlers.empty())
+      pending.push_back(std::move(todo));
+  }
+
+  // Reads the new and modified files on the worker threads by chunks,
+  // the results are applied on the main thread
+  void readPending()
+  {
+    static constexpr std::size_t chunk = 64;
+    const std::size_t count = pending.size();
+    {
+      std::lock_guard lock{mutex};
+      running = (count + chunk - 1) / chunk;
+    }
+
+    for(std::size_t i = 0; i < count; i += chunk)
+    {
+      QThreadPool::globalInstance()->start(
+          [self = shared_from_this(), begin = i, end = std::min(i + chunk, count)] {
+        self->read(begin, end);
+      });
+    }
+
+    std::unique_lock lock{mutex};
+    done.wait(lock, [this] { return running == 0; });
+  }
+
+  void read(std::size_t begin, std::size_t end)
+  {
+    struct described
+    {
+      const std::string* path;
+      const std::string* id;
+      std::string metadata;
+    };
+    std::vector<described> metadata;
+    main_thread_tasks results;
+
+    for(std::size_t i = begin; i < end && !expired(); i++)
     {
-      std::string_view suffix = path.substr(last_dot + 1);
-      if(auto it = m_watched.find(suffix); it != m_watched.end())
+      const auto& path = pending[i].path;
+      for(const auto* handler : pending[i].handlers)
       {
-        for(auto& handler : it->second)
+        if(handler->describe && handler->load)
         {
-          handler.added(path);
+          auto m = handler->describe(path);
+          if(!m.empty())
+            results.push_back([f = handler->load, path, m] { f(path, m); });
+          metadata.push_back({&path, &handler->id, std::move(m)});
         }
+        else if(handler->prepare)
+          results.push_back(handler->prepare(path));
+        else if(handler->added)
+          results.push_back([f = handler->added, path] { f(path); });
       }
     }
-  });
+
+    post(std::move(results));
+
+    std::lock_guard lock{mutex};
+    for(auto& m : metadata)
+      current.files[*m.path].metadata.emplace_back(*m.id, std::move(m.metadata));
+    if(--running == 0)
+      done.notify_one();
+  }
+
+  void post(main_thread_tasks tasks) const
+  {
+    if(tasks.empty())
+      return;
+
+    QMetaObject::invokeMethod(
+        qApp,
+        [alive = alive, tasks = std::move(tasks)] {
+      // The watch was reset or destroyed in the meantime
+      if(alive.expired())
+        return;
+      for(const auto& f : tasks)
+        if(f)
+          f();
+        },
+        Qt::QueuedConnection);
+  }
+};
+}
+
+void RecursiveWatch::scanAsync()
+{
+#if !defined(SCORE_DEPLOYMENT_BUILD)
+  static const bool disable_library = qEnvironmentVariableIsSet("SCORE_DISABLE_LIBRARY");
+  if(Q_UNLIKELY(disable_library))
+    return;
+#endif
+
+  auto j = std::make_shared<scan_job>();
+  j->root = m_root;
+  j->indexFile = m_indexFile;
+  j->watched = m_watched;
+  j->alive = m_alive;
+  {
+    std::lock_guard lock{indexMutex()};
+    j->generation = ++g_lastScan;
+  }
+
+  score::TaskPool::instance().post([j] { j->run(); });
 }
 }
@@ -8,6 +8,7 @@
 #include <score_lib_base_export.h>
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 namespace score
@@ -19,6 +20,22 @@ public:
   {
     std::function<void(std::string_view)> added;
     std::function<void(std::string_view)> removed;
+
+    //! Optional, used by scanAsync instead of added: reads the file on a
+    //! worker thread, and returns what has to be done on the main thread.
+    std::function<std::function<void()>(std::string_view)> prepare;
+
+    //! Optional, used by scanAsync before prepare: reads the metadata of a
+    //! file on a worker thread, an empty string meaning that the file is not
+    //! handled. It is saved in the index with the modification date of the
+    //! file, so that unchanged files are not read again.
+    std::function<std::string(std::string_view)> describe;
+
+    //! Called on the main thread with the metadata returned by describe
+    std::function<void(std::string_view, std::string_view)> load;
+
+    //! Identifies the metadata of this handler in the index
+    std::string id;
   };
 
   struct Watched
@@ -29,6 +46,16 @@ public:
 
   void setWatchedFolder(std::string root) { m_root = root; }
 
+  /**
+   * @brief File in which the library folder is indexed.
+   *
+   * When set, scanAsync keeps there the modification date of the folders and
+   * files, and the metadata of the files: the content of the folders which
+   * did not change is not listed again, and the metadata of the files which
+   * did not change is not read again.
+   */
+  void setIndexFile(std::string file) { m_indexFile = file; }
+
   void registerWatch(std::string extension, Callbacks callbacks)
   {
     m_watched[extension].push_back(callbacks);
@@ -36,14 +63,29 @@ public:
 
   void scan() const;
 
+  /**
+   * @brief Scans the folder without blocking the calling thread.
+   *
+   * The folder is walked in a background task, the files are prepared
+   * in parallel on the worker threads, and the results are then applied
+   * on the main thread. Only the existing files are reported: the folder
+   * is not watched for changes after the scan.
+   */
+  void scanAsync();
+
   void reset()
   {
     m_root.clear();
     m_watched.clear();
+    m_alive = std::make_shared<bool>(true);
   }
 
 private:
+  void dispatch(std::string_view path) const;
+
   std::string m_root;
+  std::string m_indexFile;
   ossia::string_map<std::vector<Callbacks>> m_watched;
+  std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
 };
 }
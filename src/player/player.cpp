@@ -2,12 +2,14 @@
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 #include "player.hpp"
 
+#include "player_clock.hpp"
 #include "player_impl.hpp"
 
 #include <Device/Protocol/DeviceInterface.hpp>
 
 #include <score/plugins/application/GUIApplicationPlugin.hpp>
 
+#include <ossia/detail/algorithms.hpp>
 #include <ossia/detail/logger.hpp>
 #include <ossia/network/generic/generic_device.hpp>
 
@@ -58,7 +60,8 @@ PlayerImpl::~PlayerImpl()
     delete[] argv[0];
     delete[] argv;
   }
-  closeDocument();
+  while (!m_players.empty())
+    closeDocument(m_players.begin()->first);
   close();
 }
 
@@ -105,14 +108,14 @@ void PlayerImpl::init()
   auto& netplug = m_components.applicationPlugin<Network::PlayerPlugin>();
   netplug.documentLoader = [&](const QByteArray& arr) {
     loadArray(arr);
-    return m_currentDocument.get();
+    return document(0)->document.get();
   };
   netplug.onDocumentLoaded = [&] {
-    Document& doc = *m_currentDocument;
-    auto plug = doc.context().findPlugin<Network::NetworkDocumentPlugin>();
+    PlayerDocument& p = *document(0);
+    auto plug = p.document->context().findPlugin<Network::NetworkDocumentPlugin>();
     if (plug)
     {
-      m_networkPlugin = plug;
+      p.networkPlugin = plug;
       auto pol
           = dynamic_cast<Network::PlayerClientEditionPolicy*>(&plug->policy());
       if (pol)
@@ -120,10 +123,11 @@ void PlayerImpl::init()
         pol->onPlay = [this] {
           prepare_play();
 
-          auto& exec_ctx = m_execPlugin->context();
-          m_execPlugin->runAllCommands();
-          Network::BasicPruner{*m_networkPlugin}(exec_ctx);
-          m_execPlugin->runAllCommands();
+          PlayerDocument& p = *document(0);
+          auto& exec_ctx = p.execPlugin->context();
+          p.execPlugin->runAllCommands();
+          Network::BasicPruner{*p.networkPlugin}(exec_ctx);
+          p.execPlugin->runAllCommands();
 
           do_play();
         };
@@ -134,13 +138,13 @@ void PlayerImpl::init()
 
 #endif
   connect(
-      this, &PlayerImpl::sig_play, this, &PlayerImpl::play,
+      this, &PlayerImpl::sig_play, this, qOverload<>(&PlayerImpl::play),
       Qt::QueuedConnection);
   connect(
-      this, &PlayerImpl::sig_stop, this, &PlayerImpl::stop,
+      this, &PlayerImpl::sig_stop, this, qOverload<>(&PlayerImpl::stop),
       Qt::QueuedConnection);
   connect(
-      this, &PlayerImpl::sig_loadFile, this, &PlayerImpl::loadFile,
+      this, &PlayerImpl::sig_loadFile, this, qOverload<QString>(&PlayerImpl::loadFile),
       Qt::QueuedConnection);
   connect(
       this, &PlayerImpl::sig_close, this, &PlayerImpl::close,
@@ -151,6 +155,22 @@ void PlayerImpl::init()
   connect(
       this, &PlayerImpl::sig_setPort, this, &PlayerImpl::setPort,
       Qt::QueuedConnection);
+
+  connect(
+      this, &PlayerImpl::sig_openFile, this, &PlayerImpl::openFile,
+      Qt::QueuedConnection);
+  connect(
+      this, &PlayerImpl::sig_playDocument, this, &PlayerImpl::playDocument,
+      Qt::QueuedConnection);
+  connect(
+      this, &PlayerImpl::sig_stopDocument, this,
+      qOverload<int>(&PlayerImpl::stop), Qt::QueuedConnection);
+  connect(
+      this, &PlayerImpl::sig_closeDocument, this,
+      qOverload<int>(&PlayerImpl::closeDocument), Qt::QueuedConnection);
+  connect(
+      this, &PlayerImpl::sig_setCores, this, &PlayerImpl::setCores,
+      Qt::QueuedConnection);
 }
 
 void PlayerImpl::registerPluginPath(std::string s)
@@ -158,33 +178,37 @@ void PlayerImpl::registerPluginPath(std::string s)
   m_pluginPath = s;
 }
 
-void PlayerImpl::closeDocument()
+PlayerDocument* PlayerImpl::document(int id) noexcept
 {
-  // Clear existing document
-  if (m_currentDocument)
-  {
-    stop();
+  auto it = m_players.find(id);
+  return it != m_players.end() ? &it->second : nullptr;
+}
+
+void PlayerImpl::closeDocument(int id)
+{
+  auto p = document(id);
+  if (!p)
+    return;
+
+  stop(id);
 
-    m_execPlugin->clear();
+  p->execPlugin->clear();
 
+  if (id == 0)
+  {
     for (auto dev : m_ownedDevices)
       releaseDevice(dev);
-
-    m_execPlugin = nullptr;
-    m_localTreePlugin = nullptr;
-    m_devicesPlugin = nullptr;
-#if defined(SCORE_ADDON_NETWORK)
-    m_networkPlugin = nullptr;
-#endif
-    m_documents.documents().clear();
-    m_documents.setCurrentDocument(nullptr);
-    m_currentDocument.reset();
   }
+
+  auto& docs = m_documents.documents();
+  docs.erase(ossia::find(docs, p->document.get()));
+  m_documents.setCurrentDocument(docs.empty() ? nullptr : docs.back());
+  m_players.erase(id);
 }
 
-void PlayerImpl::loadFile(QString file)
+void PlayerImpl::openFile(int id, QString file)
 {
-  closeDocument();
+  closeDocument(id);
 
   // Load new document
   QFile f(file);
@@ -193,40 +217,41 @@ void PlayerImpl::loadFile(QString file)
   const auto json = QJsonDocument::fromJson(f.readAll()).object();
 
   Scenario::ScenarioDocumentFactory fac;
-  m_currentDocument = std::make_unique<Document>(
-      "Untitled", json, fac, QCoreApplication::instance());
-
-  setupLoadedDocument();
+  setupLoadedDocument(
+      id, std::make_unique<Document>(
+              "Untitled", json, fac, QCoreApplication::instance()));
 }
 
 void PlayerImpl::loadArray(QByteArray network)
 {
-  closeDocument();
+  closeDocument(0);
 
   Scenario::ScenarioDocumentFactory fac;
-  m_currentDocument = std::make_unique<Document>(
-      "Untitled", QJsonDocument::fromBinaryData(network).object(), fac,
-      QCoreApplication::instance());
-
-  setupLoadedDocument();
+  setupLoadedDocument(
+      0, std::make_unique<Document>(
+             "Untitled", QJsonDocument::fromBinaryData(network).object(), fac,
+             QCoreApplication::instance()));
 }
 
-void PlayerImpl::setupLoadedDocument()
+void PlayerImpl::setupLoadedDocument(int id, std::unique_ptr<Document> doc)
 {
-  m_documents.documents().push_back(m_currentDocument.get());
-  m_documents.setCurrentDocument(m_currentDocument.get());
+  PlayerDocument& p = m_players[id];
+  p.document = std::move(doc);
+
+  m_documents.documents().push_back(p.document.get());
+  m_documents.setCurrentDocument(p.document.get());
 
   // Create execution plug-ins
-  const score::DocumentContext& ctx = m_currentDocument->context();
-  m_localTreePlugin
+  const score::DocumentContext& ctx = p.document->context();
+  p.localTreePlugin
       = new LocalTree::DocumentPlugin{ctx, Id<DocumentPlugin>{999}, nullptr};
-  m_localTreePlugin->init();
-  m_execPlugin
+  p.localTreePlugin->init();
+  p.execPlugin
       = new Execution::DocumentPlugin{ctx, Id<DocumentPlugin>{998}, nullptr};
 
-  DocumentModel& doc_model = m_currentDocument->model();
-  doc_model.addPluginModel(m_localTreePlugin);
-  doc_model.addPluginModel(m_execPlugin);
+  DocumentModel& doc_model = p.document->model();
+  doc_model.addPluginModel(p.localTreePlugin);
+  doc_model.addPluginModel(p.execPlugin);
 
 #if defined(SCORE_PLUGIN_AUDIO)
   auto& audio_ctx
@@ -237,12 +262,15 @@ void PlayerImpl::setupLoadedDocument()
       audio_ctx, ctx, Id<DocumentPlugin>{997}, nullptr});
 #endif
 
-  m_devicesPlugin = ctx.findPlugin<Explorer::DeviceDocumentPlugin>();
+  p.devicesPlugin = ctx.findPlugin<Explorer::DeviceDocumentPlugin>();
+
+  SCORE_ASSERT(p.devicesPlugin);
+  if (id != 0)
+    return;
 
-  SCORE_ASSERT(m_devicesPlugin);
   for (ossia::net::device_base* dev : m_ownedDevices)
   {
-    Device::DeviceInterface* d = m_devicesPlugin->list().findDevice(
+    Device::DeviceInterface* d = p.devicesPlugin->list().findDevice(
         QString::fromStdString(dev->get_name()));
 
     if (auto sd = dynamic_cast<Device::OwningDeviceInterface*>(d))
@@ -251,7 +279,7 @@ void PlayerImpl::setupLoadedDocument()
     }
     else
     {
-      m_devicesPlugin->list().apply([](const Device::DeviceInterface& d) {
+      p.devicesPlugin->list().apply([](const Device::DeviceInterface& d) {
         qDebug() << d.settings().name;
       });
       ossia::logger().error(
@@ -273,10 +301,27 @@ void PlayerImpl::setPort(int p)
 #endif
 }
 
+void PlayerImpl::setCores(int id, std::vector<int> cores)
+{
+  // Moving the document 0 to a thread of its own would cut it from the
+  // audio engine and thus from its audio I/O
+  if (id == 0)
+  {
+    ossia::logger().warn(
+        "Player: the document 0 runs on the audio thread, "
+        "its cores are set in the execution settings");
+    return;
+  }
+
+  if (auto p = document(id))
+    p->cores = std::move(cores);
+}
+
 void PlayerImpl::releaseDevice(ossia::net::device_base* dev)
 {
-  SCORE_ASSERT(m_devicesPlugin);
-  Device::DeviceInterface* d = m_devicesPlugin->list().findDevice(
+  auto p = document(0);
+  SCORE_ASSERT(p && p->devicesPlugin);
+  Device::DeviceInterface* d = p->devicesPlugin->list().findDevice(
       QString::fromStdString(dev->get_name()));
   if (auto sd = dynamic_cast<Device::OwningDeviceInterface*>(d))
   {
@@ -296,38 +341,56 @@ void PlayerImpl::close()
     m_app->exit(0);
 }
 
-void PlayerImpl::prepare_play()
+void PlayerImpl::prepare_play(int id)
 {
-  DocumentModel& doc_model = m_currentDocument->model();
+  auto p = document(id);
+  if (!p)
+    return;
+
+  DocumentModel& doc_model = p->document->model();
   Scenario::IntervalModel& root_cst
       = safe_cast<Scenario::ScenarioDocumentModel&>(doc_model.modelDelegate())
             .baseInterval();
-  m_execPlugin->reload(root_cst);
-  auto& exec_ctx = m_execPlugin->context();
+  p->execPlugin->reload(root_cst);
+  auto& exec_ctx = p->execPlugin->context();
 
-  auto& exec_settings = m_appContext.settings<Execution::Settings::Model>();
-  m_clock = exec_settings.makeClock(exec_ctx);
+  // The audio engine can only drive one document:
+  // the others run on their own thread.
+  if (id == 0)
+  {
+    auto& exec_settings = m_appContext.settings<Execution::Settings::Model>();
+    p->clock = exec_settings.makeClock(exec_ctx);
+  }
+  else
+  {
+    p->clock = std::make_unique<PlayerClock>(exec_ctx, p->cores);
+  }
 }
 
-void PlayerImpl::do_play()
+void PlayerImpl::do_play(int id)
 {
-  m_clock->play(TimeVal::zero());
+  if (auto p = document(id); p && p->clock)
+    p->clock->play(TimeVal::zero());
 }
 
-void PlayerImpl::stop()
+void PlayerImpl::stop(int id)
 {
-  if (m_clock)
-    m_clock->stop();
+  auto p = document(id);
+  if (!p)
+    return;
+
+  if (p->clock)
+    p->clock->stop();
 
 #if defined(SCORE_ADDON_NETWORK)
-  if (m_networkPlugin)
-    m_networkPlugin->on_stop();
+  if (p->networkPlugin)
+    p->networkPlugin->on_stop();
 #endif
 
-  if (m_execPlugin)
-    m_execPlugin->clear();
+  if (p->execPlugin)
+    p->execPlugin->clear();
 
-  m_clock.reset();
+  p->clock.reset();
 }
 
 const ApplicationContext& PlayerImpl::context() const
@@ -451,7 +514,11 @@ Player::Player(std::string plugin_path)
       m_player->registerPluginPath(plugins);
 
       m_player->init();
-      m_loaded = true;
+      {
+        std::lock_guard lock{m_loadMutex};
+        m_loaded = true;
+      }
+      m_loadCondition.notify_all();
       m_player->exec();
       m_player.reset();
     });
@@ -469,6 +536,12 @@ Player::~Player()
   m_player.reset();
 }
 
+void Player::waitLoaded()
+{
+  std::unique_lock lock{m_loadMutex};
+  m_loadCondition.wait(lock, [this] { return m_loaded.load(); });
+}
+
 void Player::setPort(int port)
 {
   assert(m_loaded);
@@ -477,8 +550,7 @@ void Player::setPort(int port)
 
 void Player::load(std::string path)
 {
-  while (!m_loaded)
-    ;
+  waitLoaded();
   m_player->sig_loadFile(QString::fromStdString(path));
 }
 
@@ -498,4 +570,36 @@ void Player::registerDevice(ossia::net::device_base& dev)
 {
   m_player->sig_registerDevice(&dev);
 }
+
+int Player::open(std::string path)
+{
+  waitLoaded();
+  const int id = m_nextDocument++;
+  m_player->sig_openFile(id, QString::fromStdString(path));
+  return id;
+}
+
+void Player::play(int document)
+{
+  assert(m_loaded);
+  m_player->sig_playDocument(document);
+}
+
+void Player::stop(int document)
+{
+  assert(m_loaded);
+  m_player->sig_stopDocument(document);
+}
+
+void Player::close(int document)
+{
+  assert(m_loaded);
+  m_player->sig_closeDocument(document);
+}
+
+void Player::setCores(int document, std::vector<int> cores)
+{
+  assert(m_loaded);
+  m_player->sig_setCores(document, std::move(cores));
+}
 }
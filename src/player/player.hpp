@@ -2,8 +2,11 @@
 #include <score_player_export.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 namespace ossia
 {
 namespace net
@@ -27,9 +30,32 @@ public:
   void stop();
   void registerDevice(ossia::net::device_base&);
 
+  /**
+   * Documents loaded with open() share the plug-ins and settings of this
+   * player and execute concurrently, each on a thread of its own.
+   * The document 0 is the one used by load(), play() and stop(),
+   * and is the only one driven by the audio engine.
+   * Compiled processes, such as Faust factories and shaders, are not shared
+   * between the documents.
+   */
+  int open(std::string path);
+  void play(int document);
+  void stop(int document);
+  void close(int document);
+
+  //! Pins the execution thread of a document, before it is played.
+  //! The document 0 runs on the audio thread, which is placed with the
+  //! execution settings instead.
+  void setCores(int document, std::vector<int> cores);
+
 private:
+  void waitLoaded();
+
   std::unique_ptr<PlayerImpl> m_player;
   std::thread m_thread;
+  std::mutex m_loadMutex;
+  std::condition_variable m_loadCondition;
   std::atomic_bool m_loaded{};
+  std::atomic_int m_nextDocument{1};
 };
 }
@@ -0,0 +1,56 @@
+#include "player_clock.hpp"
+
+#include <Execution/DocumentPlugin.hpp>
+#include <Execution/ExecutionThreads.hpp>
+#include <Execution/Settings/ExecutorModel.hpp>
+
+#include <ossia/dataflow/execution_state.hpp>
+#include <ossia/detail/logger.hpp>
+
+#include <chrono>
+
+namespace score
+{
+PlayerClock::PlayerClock(const Execution::Context& ctx, std::vector<int> cores)
+    : Execution::ThreadedClock{ctx}
+    , m_cores{std::move(cores)}
+{
+}
+
+PlayerClock::~PlayerClock()
+{
+  join();
+}
+
+void PlayerClock::run()
+{
+  auto threads = Execution::ThreadConfiguration::fromSettings(m_plug.settings);
+  if (!m_cores.empty())
+    threads.cores = m_cores;
+
+  if (!Execution::pinCurrentThread(threads.cores))
+    ossia::logger().warn("Player: could not pin the execution thread");
+  if (threads.realtime && !Execution::setCurrentThreadRealtime(true))
+    ossia::logger().warn("Player: could not set the execution thread priority");
+
+  const auto& st = *m_plug.contextData()->execState;
+  const uint64_t frames = st.bufferSize;
+  const auto period = std::chrono::nanoseconds(
+      int64_t(1e9 * double(frames) / double(st.sampleRate)));
+
+  ossia::audio_tick_state t{};
+  t.frames = frames;
+
+  auto next = std::chrono::steady_clock::now();
+  while (m_running)
+  {
+    next += period;
+    if (!m_paused)
+    {
+      m_tick(t);
+      t.seconds += double(frames) / double(st.sampleRate);
+    }
+    Execution::waitUntil(next, threads.spin);
+  }
+}
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <Execution/Clock/ThreadedClock.hpp>
+
+#include <vector>
+
+namespace score
+{
+/**
+ * @brief Runs the execution of a document on a thread of its own
+ *
+ * Used by the player to execute several documents concurrently in the same
+ * process: the audio engine can only drive a single tick, thus every other
+ * document ticks at the rate and buffer size of the execution settings
+ * without audio I/O, optionally pinned to a set of cores.
+ */
+class PlayerClock final : public Execution::ThreadedClock
+{
+public:
+  PlayerClock(const Execution::Context& ctx, std::vector<int> cores);
+  ~PlayerClock() override;
+
+private:
+  void run() override;
+
+  std::vector<int> m_cores;
+};
+}
@@ -37,12 +37,28 @@
 #include <Execution/Settings/ExecutorModel.hpp>
 #include <LocalTree/LocalTreeDocumentPlugin.hpp>
 #include <score_player_export.h>
+
+#include <map>
 namespace Network
 {
 class NetworkDocumentPlugin;
 }
 namespace score
 {
+//! A document loaded in the player, with its execution plug-ins
+struct PlayerDocument
+{
+  std::unique_ptr<Document> document;
+  Explorer::DeviceDocumentPlugin* devicesPlugin{};
+  Execution::DocumentPlugin* execPlugin{};
+  LocalTree::DocumentPlugin* localTreePlugin{};
+  Network::NetworkDocumentPlugin* networkPlugin{};
+  std::unique_ptr<Execution::Clock> clock;
+
+  //! Cores the execution thread of this document is pinned to
+  std::vector<int> cores;
+};
+
 class SCORE_PLAYER_EXPORT PlayerImpl : public QObject,
                                        public ApplicationInterface
 {
@@ -57,20 +73,25 @@ public:
 
   void init();
   void registerPluginPath(std::string);
-  void closeDocument();
+  void closeDocument() { closeDocument(0); }
+  void closeDocument(int id);
 
   void exec();
   void close();
 
-  void loadFile(QString file);
+  void loadFile(QString file) { openFile(0, file); }
+  void openFile(int id, QString file);
   void loadArray(QByteArray network);
 
   void registerDevice(ossia::net::device_base*);
   void releaseDevice(ossia::net::device_base*);
   void setPort(int);
+  void setCores(int id, std::vector<int> cores);
 
-  void prepare_play();
-  void do_play();
+  void prepare_play() { prepare_play(0); }
+  void prepare_play(int id);
+  void do_play() { do_play(0); }
+  void do_play(int id);
 
   void play()
   {
@@ -78,7 +99,14 @@ public:
     do_play();
   }
 
-  void stop();
+  void playDocument(int id)
+  {
+    prepare_play(id);
+    do_play(id);
+  }
+
+  void stop() { stop(0); }
+  void stop(int id);
 
   void loadPlugins(
       ApplicationRegistrar& registrar, const ApplicationContext& context);
@@ -91,8 +119,15 @@ public:
   void sig_setPort(int);
   void sig_registerDevice(ossia::net::device_base*);
 
+  void sig_openFile(int, QString);
+  void sig_playDocument(int);
+  void sig_stopDocument(int);
+  void sig_closeDocument(int);
+  void sig_setCores(int, std::vector<int>);
+
 private:
-  void setupLoadedDocument();
+  void setupLoadedDocument(int id, std::unique_ptr<Document> doc);
+  PlayerDocument* document(int id) noexcept;
   const ApplicationContext& context() const override;
   const ApplicationComponents& components() const override;
 
@@ -102,7 +137,7 @@ private:
   // Load core application and plug-ins
   std::unique_ptr<QCoreApplication> m_app{};
 
-  // Application-specific
+  // Application-specific: shared by all the documents
   std::string m_pluginPath;
   ApplicationSettings m_globSettings;
   ApplicationComponentsData m_compData;
@@ -113,13 +148,10 @@ private:
   ApplicationContext m_appContext{m_globSettings, m_components, m_documents,
                                   m_settings};
 
-  // Document-specific
-  std::unique_ptr<Document> m_currentDocument;
-  Explorer::DeviceDocumentPlugin* m_devicesPlugin{};
-  Execution::DocumentPlugin* m_execPlugin{};
-  LocalTree::DocumentPlugin* m_localTreePlugin{};
-  Network::NetworkDocumentPlugin* m_networkPlugin{};
-  std::unique_ptr<Execution::Clock> m_clock;
+  // Document-specific.
+  // The document 0 is the one driven by the single-document API
+  // and by the network, and owns the registered devices.
+  std::map<int, PlayerDocument> m_players;
 
   std::vector<ossia::net::device_base*> m_ownedDevices;
 };
@@ -0,0 +1,47 @@
+#pragma once
+#include <ossia/dataflow/exec_state_facade.hpp>
+#include <ossia/dataflow/token_request.hpp>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace Execution
+{
+/**
+ * @brief Execution node which tells the UI when it has values for it
+ *
+ * Wraps a node type whose run() pushes values for the UI in queues,
+ * such as the safe_node of the control processes. After each tick in which
+ * HasValues returns true for the node, notify is called: it is obtained with
+ * SetupContext::register_notified_gui_update, so that the UI only updates
+ * the nodes which changed instead of polling all of them.
+ *
+ * Node types which cannot be derived from cannot notify anything,
+ * see can_notify_gui: their updates have to be registered with
+ * SetupContext::register_gui_update.
+ */
+template <typename Node_T, typename HasValues>
+class gui_notifying_node final : public Node_T
+{
+public:
+  template <typename... Args>
+  explicit gui_notifying_node(Args&&... args)
+      : Node_T{std::forward<Args>(args)...}
+  {
+  }
+
+  //! Set before the node is added to the graph
+  std::function<void()> notify;
+
+  void run(const ossia::token_request& t, ossia::exec_state_facade e) noexcept override
+  {
+    Node_T::run(t, e);
+    if(notify && HasValues{}(static_cast<const Node_T&>(*this)))
+      notify();
+  }
+};
+
+template <typename Node_T>
+static constexpr bool can_notify_gui = !std::is_final_v<Node_T>;
+}
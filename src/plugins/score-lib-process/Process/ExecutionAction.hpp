@@ -15,6 +15,15 @@ public:
   virtual ~ExecutionAction();
   virtual void startTick(const ossia::audio_tick_state& st);
   virtual void endTick(const ossia::audio_tick_state& st);
+
+  //! Called from the main thread when the offline clock starts:
+  //! until offlineStopped, endTick is allowed to wait for the rendering
+  //! of what the tick produced.
+  virtual void offlineStarted();
+
+  //! Called from the main thread before the thread of the offline clock is
+  //! joined: a tick waiting in endTick has to return.
+  virtual void offlineStopped();
 };
 
 class SCORE_LIB_PROCESS_EXPORT ExecutionActionList final
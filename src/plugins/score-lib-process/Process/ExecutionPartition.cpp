@@ -0,0 +1,871 @@
+#include "ExecutionPartition.hpp"
+
+#include <Process/Process.hpp>
+#include <Process/ProcessFlags.hpp>
+
+#include <score/model/path/Path.hpp>
+
+#include <ossia/dataflow/graph_node.hpp>
+#include <ossia/dataflow/port.hpp>
+#include <ossia/detail/hash_map.hpp>
+
+#include <QDebug>
+#include <QString>
+#include <QStringList>
+
+#include <readerwriterqueue.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define SCORE_EXECUTION_PARTITION_SUPPORTED 1
+#endif
+
+namespace Execution
+{
+namespace
+{
+// "SCPA"
+static constexpr uint32_t packet_magic = 0x53435041;
+static constexpr int base_port = 9950;
+static constexpr std::size_t max_datagram = 65000;
+static constexpr int64_t flicks_per_second = 705600000;
+// A sequence number this far behind means that the sender was restarted
+static constexpr int64_t restart_frames = 64;
+// Ticks of datagrams a sender can queue before the sending thread sends them
+static constexpr int outbox_ticks = 4;
+// Audio channels allocated for a cable when its source has none yet
+static constexpr int min_channels = 2;
+
+enum PacketKind : uint8_t
+{
+  AudioPacket,
+  ValuePacket
+};
+
+struct PacketHeader
+{
+  uint32_t magic{packet_magic};
+  int32_t cable{};
+  int64_t sequence{}; // Index of the tick of the sender in which this was sent
+  int64_t date{};     // Date of the sender's timeline at that tick, in flicks
+  uint8_t kind{};
+  uint8_t reserved{};
+  uint16_t channel{};
+  uint16_t channels{};
+  uint16_t count{}; // Number of floats following the header
+};
+
+static constexpr std::size_t max_floats
+    = (max_datagram - sizeof(PacketHeader)) / sizeof(float);
+
+struct Packet
+{
+  PacketHeader header;
+  std::vector<float> data;
+};
+
+//! What was sent for a cable during one tick of the sender
+struct Frame
+{
+  int64_t sequence{-1};
+  int64_t date{};
+  int channels{};
+  int received{};
+  std::vector<std::vector<float>> audio;
+  std::vector<float> values;
+};
+
+/**
+ * The frames of a cable go through a FIFO: the receiving node only starts
+ * reading it once it holds the target latency, then reads one frame per tick.
+ * When it runs empty (underrun) silence is output until it is filled again,
+ * and when the network catches up the oldest frames are dropped so that
+ * the latency stays bounded.
+ */
+struct Link
+{
+  Link(int target, int channels, int bufferSize)
+      : target{target}
+      , received(capacity(target))
+      , released(capacity(target) + 2)
+  {
+    for(int i = 0; i < capacity(target); i++)
+    {
+      Frame f;
+      f.audio.resize(channels);
+      for(auto& chan : f.audio)
+        chan.reserve(bufferSize);
+      released.try_enqueue(std::move(f));
+    }
+  }
+
+  static int capacity(int target) noexcept { return std::max(4 * target, 8); }
+
+  const int target{};
+
+  // Filled by the receiving thread, read by the execution.
+  // Both are bounded: the frames in flight, at most one more being assembled
+  // and one being played, always fit back in the released ones.
+  moodycamel::ReaderWriterQueue<Frame> received;
+  // Frames given back by the execution so that their buffers are reused
+  moodycamel::ReaderWriterQueue<Frame> released;
+
+  // Only used by the receiving thread
+  Frame assembling;
+  int64_t flushed{-1};
+
+  // Statistics, in frames and in flicks
+  std::atomic<int64_t> frames{};
+  std::atomic<int64_t> depthSum{};
+  std::atomic<int64_t> depthMax{};
+  std::atomic<int64_t> underruns{};
+  std::atomic<int64_t> dropped{};
+  std::atomic<int64_t> offsetSum{};
+  std::atomic<int64_t> frameDuration{};
+
+  void push(const Packet& p)
+  {
+    const int64_t last = std::max(assembling.sequence, flushed);
+    if(p.header.sequence + restart_frames < last)
+    {
+      assembling = Frame{};
+      flushed = -1;
+    }
+    // Packets arriving after a newer tick was started are too late
+    else if(p.header.sequence < assembling.sequence || p.header.sequence <= flushed)
+    {
+      return;
+    }
+
+    // A packet of a newer tick completes the previous one,
+    // even if some of its channels were lost
+    if(assembling.sequence != p.header.sequence)
+    {
+      if(assembling.sequence != -1)
+        flush();
+      start(p.header);
+    }
+
+    if(p.header.kind == AudioPacket)
+    {
+      if(p.header.channel < assembling.audio.size())
+      {
+        auto& chan = assembling.audio[p.header.channel];
+        chan.assign(p.data.begin(), p.data.end());
+        assembling.received++;
+      }
+    }
+    else
+    {
+      assembling.values.assign(p.data.begin(), p.data.end());
+      assembling.received = assembling.channels;
+    }
+
+    if(assembling.received >= assembling.channels)
+      flush();
+  }
+
+private:
+  void start(const PacketHeader& h)
+  {
+    if(!released.try_dequeue(assembling))
+      assembling = Frame{};
+    assembling.sequence = h.sequence;
+    assembling.date = h.date;
+    assembling.received = 0;
+    assembling.values.clear();
+    if(h.kind == AudioPacket)
+    {
+      assembling.channels = h.channels;
+      assembling.audio.resize(h.channels);
+      for(auto& chan : assembling.audio)
+        chan.clear();
+    }
+    else
+    {
+      assembling.channels = 1;
+      assembling.audio.clear();
+    }
+  }
+
+  void flush()
+  {
+    flushed = assembling.sequence;
+    // The execution is not reading the FIFO, e.g. before it starts:
+    // the frame is dropped
+    if(!received.try_enqueue(std::move(assembling)))
+      dropped.fetch_add(1, std::memory_order_relaxed);
+    assembling = Frame{};
+  }
+};
+
+struct Datagram
+{
+  std::vector<char> data;
+  std::size_t size{};
+};
+
+/**
+ * The datagrams of a sender are allocated when its cable is set up:
+ * the execution fills the available ones and queues them, the sending
+ * thread sends them and gives them back.
+ */
+struct Outbox
+{
+  Outbox(int32_t cable, int partition, int count, std::size_t size)
+      : cable{cable}
+      , partition{partition}
+      , pending(count)
+      , available(count)
+  {
+    for(int i = 0; i < count; i++)
+      available.try_enqueue(Datagram{std::vector<char>(size), 0});
+  }
+
+  const int32_t cable{};
+  const int partition{};
+
+  moodycamel::ReaderWriterQueue<Datagram> pending;
+  moodycamel::ReaderWriterQueue<Datagram> available;
+
+  // Datagrams dropped because the sending thread did not keep up
+  std::atomic<int64_t> unsent{};
+};
+
+// Values are sent as [timestamp, size, data...]:
+// impulses, numbers and vectors are supported.
+static int encodeValue(const ossia::timed_value& v, float* out, int remaining) noexcept
+{
+  const float* data{};
+  float num{};
+  int size = 0;
+  switch(v.value.get_type())
+  {
+    case ossia::val_type::IMPULSE:
+      break;
+    case ossia::val_type::INT:
+      num = *v.value.target<int>();
+      data = &num;
+      size = 1;
+      break;
+    case ossia::val_type::FLOAT:
+      data = v.value.target<float>();
+      size = 1;
+      break;
+    case ossia::val_type::BOOL:
+      num = *v.value.target<bool>();
+      data = &num;
+      size = 1;
+      break;
+    case ossia::val_type::VEC2F:
+      data = v.value.target<ossia::vec2f>()->data();
+      size = 2;
+      break;
+    case ossia::val_type::VEC3F:
+      data = v.value.target<ossia::vec3f>()->data();
+      size = 3;
+      break;
+    case ossia::val_type::VEC4F:
+      data = v.value.target<ossia::vec4f>()->data();
+      size = 4;
+      break;
+    default:
+      return 0;
+  }
+
+  if(size + 2 > remaining)
+    return 0;
+
+  out[0] = v.timestamp;
+  out[1] = size;
+  std::copy_n(data, size, out + 2);
+  return size + 2;
+}
+
+static ossia::value decodeValue(const float* data, int size) noexcept
+{
+  switch(size)
+  {
+    case 0:
+      return ossia::impulse{};
+    case 1:
+      return data[0];
+    case 2:
+      return ossia::vec2f{data[0], data[1]};
+    case 3:
+      return ossia::vec3f{data[0], data[1], data[2]};
+    default:
+      return ossia::vec4f{data[0], data[1], data[2], data[3]};
+  }
+}
+}
+
+struct ExecutionPartition::Impl
+{
+#if defined(SCORE_EXECUTION_PARTITION_SUPPORTED)
+  int socket{-1};
+  std::vector<sockaddr_storage> destinations;
+  std::vector<socklen_t> destinationSizes;
+#endif
+  std::thread receiver;
+  std::thread sender;
+  std::atomic_bool running{};
+  std::atomic_bool sendPending{};
+
+  // Frames buffered by each cable before it starts being read
+  int latency{2};
+
+  std::mutex linksMutex;
+  ossia::hash_map<int32_t, std::shared_ptr<Link>> links;
+
+  std::mutex outboxesMutex;
+  std::vector<std::weak_ptr<Outbox>> outboxes;
+
+  std::chrono::steady_clock::time_point lastReport{};
+
+  void send(int partition, const char* data, std::size_t size) noexcept
+  {
+#if defined(SCORE_EXECUTION_PARTITION_SUPPORTED)
+    if(socket == -1 || partition < 0 || partition >= std::ssize(destinations))
+      return;
+    ::sendto(
+        socket, data, size, 0, (const sockaddr*)&destinations[partition],
+        destinationSizes[partition]);
+#endif
+  }
+
+  //! Called by the execution once it has queued datagrams
+  void wakeSender() noexcept
+  {
+    if(!sendPending.exchange(true))
+      sendPending.notify_one();
+  }
+
+  void sendQueued()
+  {
+    std::vector<std::shared_ptr<Outbox>> current;
+    Datagram d;
+    while(running)
+    {
+      sendPending.wait(false);
+      sendPending = false;
+
+      {
+        std::lock_guard _{outboxesMutex};
+        std::erase_if(outboxes, [](const auto& o) { return o.expired(); });
+        for(const auto& o : outboxes)
+          if(auto outbox = o.lock())
+            current.push_back(std::move(outbox));
+      }
+
+      for(const auto& outbox : current)
+      {
+        while(outbox->pending.try_dequeue(d))
+        {
+          send(outbox->partition, d.data.data(), d.size);
+          outbox->available.try_enqueue(std::move(d));
+        }
+      }
+      current.clear();
+    }
+  }
+
+  void receive()
+  {
+#if defined(SCORE_EXECUTION_PARTITION_SUPPORTED)
+    std::vector<char> buffer(max_datagram);
+    while(running)
+    {
+      const auto n = ::recv(socket, buffer.data(), buffer.size(), 0);
+      if(n < std::ssize_t(sizeof(PacketHeader)))
+        continue;
+
+      Packet p;
+      std::memcpy(&p.header, buffer.data(), sizeof(PacketHeader));
+      if(p.header.magic != packet_magic
+         || sizeof(PacketHeader) + p.header.count * sizeof(float) > std::size_t(n))
+        continue;
+
+      std::shared_ptr<Link> link;
+      {
+        std::lock_guard _{linksMutex};
+        if(auto it = links.find(p.header.cable); it != links.end())
+          link = it->second;
+      }
+      if(!link)
+        continue;
+
+      p.data.resize(p.header.count);
+      std::memcpy(
+          p.data.data(), buffer.data() + sizeof(PacketHeader),
+          p.header.count * sizeof(float));
+      link->push(p);
+    }
+#endif
+  }
+};
+
+namespace
+{
+class partition_sender final : public ossia::nonowning_graph_node
+{
+public:
+  partition_sender(
+      std::shared_ptr<ExecutionPartition::Impl> impl, std::shared_ptr<Outbox> outbox,
+      bool audio)
+      : m_impl{std::move(impl)}
+      , m_outbox{std::move(outbox)}
+      , m_audio{audio}
+  {
+    if(m_audio)
+      m_inlets.push_back(&audio_in);
+    else
+      m_inlets.push_back(&value_in);
+  }
+
+  void run(const ossia::token_request& tk, ossia::exec_state_facade st) noexcept override
+  {
+    PacketHeader h;
+    h.cable = m_outbox->cable;
+    h.sequence = m_sequence++;
+    h.date = tk.date.impl;
+
+    Datagram d;
+    if(m_audio)
+    {
+      const auto& channels = (*audio_in).get();
+      h.kind = AudioPacket;
+      h.channels = channels.size();
+      for(std::size_t c = 0; c < channels.size(); c++)
+      {
+        if(!m_outbox->available.try_dequeue(d))
+        {
+          m_outbox->unsent.fetch_add(1, std::memory_order_relaxed);
+          continue;
+        }
+
+        const auto& samples = channels[c];
+        h.channel = c;
+        h.count = std::min(samples.size(), capacity(d));
+        std::copy_n(samples.data(), h.count, payload(d));
+        queue(h, d);
+      }
+    }
+    else
+    {
+      if(!m_outbox->available.try_dequeue(d))
+      {
+        m_outbox->unsent.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+
+      h.kind = ValuePacket;
+      int count = 0;
+      for(const ossia::timed_value& v : (*value_in).get_data())
+        count += encodeValue(v, payload(d) + count, int(capacity(d)) - count);
+
+      // Sent even if empty, so that the receiver reads one frame per tick
+      h.count = count;
+      queue(h, d);
+    }
+
+    m_impl->wakeSender();
+  }
+
+  std::string label() const noexcept override { return "Partition sender"; }
+
+private:
+  static float* payload(Datagram& d) noexcept
+  {
+    return reinterpret_cast<float*>(d.data.data() + sizeof(PacketHeader));
+  }
+
+  static std::size_t capacity(const Datagram& d) noexcept
+  {
+    return (d.data.size() - sizeof(PacketHeader)) / sizeof(float);
+  }
+
+  void queue(const PacketHeader& h, Datagram& d) noexcept
+  {
+    std::memcpy(d.data.data(), &h, sizeof(PacketHeader));
+    d.size = sizeof(PacketHeader) + h.count * sizeof(float);
+    // Holds every datagram of the outbox: this cannot fail
+    m_outbox->pending.try_enqueue(std::move(d));
+  }
+
+  std::shared_ptr<ExecutionPartition::Impl> m_impl;
+  std::shared_ptr<Outbox> m_outbox;
+  int64_t m_sequence{};
+  bool m_audio{};
+
+  ossia::audio_inlet audio_in;
+  ossia::value_inlet value_in;
+};
+
+class partition_receiver final : public ossia::nonowning_graph_node
+{
+public:
+  partition_receiver(
+      std::shared_ptr<Link> link, bool audio, int channels, int bufferSize)
+      : m_link{std::move(link)}
+      , m_audio{audio}
+  {
+    if(m_audio)
+    {
+      // The output is not resized during the execution
+      m_outlets.push_back(&audio_out);
+      (*audio_out).set_channels(channels);
+      for(auto& chan : (*audio_out).get())
+        chan.reserve(bufferSize);
+    }
+    else
+    {
+      m_outlets.push_back(&value_out);
+    }
+  }
+
+  void run(const ossia::token_request& tk, ossia::exec_state_facade st) noexcept override
+  {
+    Link& link = *m_link;
+    if(!m_primed)
+    {
+      if(int(link.received.size_approx()) < link.target)
+      {
+        silence(st);
+        return;
+      }
+      m_primed = true;
+    }
+
+    // The network caught up after a stall: the frames beyond twice
+    // the target latency are dropped, oldest first
+    while(int(link.received.size_approx()) > 2 * link.target && pop())
+      link.dropped.fetch_add(1, std::memory_order_relaxed);
+
+    // Frames arriving after a more recent one was played are dropped too
+    bool ok = pop();
+    while(ok && m_frame.sequence <= m_played
+          && m_frame.sequence + restart_frames >= m_played)
+      ok = pop();
+
+    if(!ok)
+    {
+      link.underruns.fetch_add(1, std::memory_order_relaxed);
+      m_primed = false;
+      silence(st);
+      return;
+    }
+
+    m_played = m_frame.sequence;
+    write(m_frame, st);
+
+    const int64_t depth = link.received.size_approx();
+    link.frames.fetch_add(1, std::memory_order_relaxed);
+    link.depthSum.fetch_add(depth, std::memory_order_relaxed);
+    int64_t prev = link.depthMax.load(std::memory_order_relaxed);
+    while(depth > prev && !link.depthMax.compare_exchange_weak(prev, depth))
+      ;
+    link.offsetSum.fetch_add(tk.date.impl - m_frame.date, std::memory_order_relaxed);
+    link.frameDuration.store(
+        int64_t(double(flicks_per_second) * st.bufferSize() / st.sampleRate()),
+        std::memory_order_relaxed);
+  }
+
+  std::string label() const noexcept override { return "Partition receiver"; }
+
+private:
+  //! Takes the next frame, giving the buffers of the previous one back
+  bool pop() noexcept
+  {
+    if(m_frame.sequence != -1)
+    {
+      // Holds every frame of the link: this cannot fail
+      m_link->released.try_enqueue(std::move(m_frame));
+      m_frame = Frame{};
+    }
+    return m_link->received.try_dequeue(m_frame);
+  }
+
+  void silence(ossia::exec_state_facade st) noexcept
+  {
+    if(!m_audio)
+      return;
+    for(auto& chan : (*audio_out).get())
+      chan.assign(st.bufferSize(), 0.);
+  }
+
+  void write(const Frame& f, ossia::exec_state_facade st) noexcept
+  {
+    if(m_audio)
+    {
+      // The channels lost on the network are silent, and the ones beyond
+      // those allocated when the cable was set up are dropped
+      auto& channels = (*audio_out).get();
+      for(std::size_t c = 0; c < channels.size(); c++)
+      {
+        auto& chan = channels[c];
+        chan.assign(st.bufferSize(), 0.);
+        if(c < f.audio.size())
+          std::copy_n(
+              f.audio[c].data(), std::min(f.audio[c].size(), chan.size()), chan.data());
+      }
+    }
+    else
+    {
+      ossia::value_port& out = *value_out;
+      const float* data = f.values.data();
+      const float* end = data + f.values.size();
+      while(data + 2 <= end)
+      {
+        const int64_t ts = data[0];
+        const int size = data[1];
+        if(data + 2 + size > end)
+          break;
+        out.write_value(decodeValue(data + 2, size), ts);
+        data += 2 + size;
+      }
+    }
+  }
+
+  std::shared_ptr<Link> m_link;
+  Frame m_frame;
+  int64_t m_played{-1};
+  bool m_primed{};
+  bool m_audio{};
+
+  ossia::audio_outlet audio_out;
+  ossia::value_outlet value_out;
+};
+}
+
+std::shared_ptr<ExecutionPartition> ExecutionPartition::instance()
+{
+#if defined(SCORE_EXECUTION_PARTITION_SUPPORTED)
+  static std::weak_ptr<ExecutionPartition> current;
+  if(auto p = current.lock())
+    return p;
+
+  const auto spec = qEnvironmentVariable("SCORE_EXECUTION_PARTITION").split('/');
+  if(spec.size() != 2)
+    return {};
+
+  const int index = spec[0].toInt();
+  const int count = spec[1].toInt();
+  if(count <= 1 || index < 0 || index >= count)
+    return {};
+
+  std::shared_ptr<ExecutionPartition> p{new ExecutionPartition{index, count}};
+  current = p;
+  return p;
+#else
+  return {};
+#endif
+}
+
+ExecutionPartition::ExecutionPartition(int index, int count)
+    : m_impl{std::make_shared<Impl>()}
+    , m_index{index}
+    , m_count{count}
+{
+#if defined(SCORE_EXECUTION_PARTITION_SUPPORTED)
+  auto& impl = *m_impl;
+  bool latencyOk = false;
+  const int latency
+      = qEnvironmentVariableIntValue("SCORE_EXECUTION_PARTITION_LATENCY", &latencyOk);
+  if(latencyOk && latency > 0)
+    impl.latency = latency;
+
+  auto hosts = qEnvironmentVariable("SCORE_EXECUTION_PARTITION_HOSTS").split(',');
+  impl.destinations.resize(count);
+  impl.destinationSizes.resize(count);
+  for(int i = 0; i < count; i++)
+  {
+    const auto host = i < hosts.size() && !hosts[i].isEmpty()
+                          ? hosts[i].toStdString()
+                          : std::string("127.0.0.1");
+    const auto port = std::to_string(base_port + i);
+
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* res{};
+    if(::getaddrinfo(host.c_str(), port.c_str(), &hints, &res) == 0 && res)
+    {
+      std::memcpy(&impl.destinations[i], res->ai_addr, res->ai_addrlen);
+      impl.destinationSizes[i] = res->ai_addrlen;
+      ::freeaddrinfo(res);
+    }
+    else
+    {
+      qDebug() << "Execution partition: cannot resolve" << host.c_str();
+    }
+  }
+
+  impl.socket = ::socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in local{};
+  local.sin_family = AF_INET;
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  local.sin_port = htons(base_port + index);
+  if(impl.socket == -1 || ::bind(impl.socket, (sockaddr*)&local, sizeof(local)) != 0)
+  {
+    qDebug() << "Execution partition: cannot listen on port" << base_port + index;
+    return;
+  }
+
+  // So that the receiving thread can notice when it has to stop
+  timeval timeout{0, 100000};
+  ::setsockopt(impl.socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  impl.running = true;
+  impl.receiver = std::thread{[&impl] { impl.receive(); }};
+  impl.sender = std::thread{[&impl] { impl.sendQueued(); }};
+
+  qDebug() << "Execution partition" << index << "of" << count << "listening on port"
+           << base_port + index;
+#endif
+}
+
+ExecutionPartition::~ExecutionPartition()
+{
+  m_impl->running = false;
+  if(m_impl->receiver.joinable())
+    m_impl->receiver.join();
+  if(m_impl->sender.joinable())
+  {
+    m_impl->sendPending = true;
+    m_impl->sendPending.notify_one();
+    m_impl->sender.join();
+  }
+
+#if defined(SCORE_EXECUTION_PARTITION_SUPPORTED)
+  if(m_impl->socket != -1)
+    ::close(m_impl->socket);
+  m_impl->socket = -1;
+#endif
+}
+
+int ExecutionPartition::partition(const Process::ProcessModel& proc) const noexcept
+{
+  // Processes which drive the timeline run in every partition
+  if(!(proc.flags() & Process::ProcessFlags::TimeIndependent))
+    return -1;
+
+  // Ids are only unique among the processes of an interval:
+  // the path of the process is the same in every instance
+  const Path<Process::ProcessModel> path{proc};
+  return int(std::hash<ObjectPath>{}(path.unsafePath()) % std::size_t(m_count));
+}
+
+bool ExecutionPartition::isLocal(const Process::ProcessModel& proc) const noexcept
+{
+  const int p = partition(proc);
+  return p == -1 || p == m_index;
+}
+
+std::shared_ptr<ossia::graph_node> ExecutionPartition::makeSender(
+    int32_t cable, int partition, const ossia::outlet& source, int bufferSize)
+{
+  std::shared_ptr<Outbox> outbox;
+  bool audio{};
+  if(auto port = source.target<ossia::audio_port>())
+  {
+    // One datagram per channel and per tick
+    const int channels = std::max(min_channels, int(port->get().size()));
+    const std::size_t floats = std::min(std::size_t(bufferSize), max_floats);
+    outbox = std::make_shared<Outbox>(
+        cable, partition, outbox_ticks * channels,
+        sizeof(PacketHeader) + floats * sizeof(float));
+    audio = true;
+  }
+  else if(source.target<ossia::value_port>())
+  {
+    outbox = std::make_shared<Outbox>(cable, partition, outbox_ticks, max_datagram);
+  }
+  else
+  {
+    return {};
+  }
+
+  {
+    std::lock_guard _{m_impl->outboxesMutex};
+    m_impl->outboxes.push_back(outbox);
+  }
+  return std::make_shared<partition_sender>(m_impl, std::move(outbox), audio);
+}
+
+std::shared_ptr<ossia::graph_node> ExecutionPartition::makeReceiver(
+    int32_t cable, const ossia::outlet& source, const ossia::inlet& sink, int bufferSize)
+{
+  const bool audio = sink.target<ossia::audio_port>();
+  if(!audio && !sink.target<ossia::value_port>())
+    return {};
+
+  // The source runs in another instance, but its node exists here too
+  int channels = min_channels;
+  if(auto port = source.target<ossia::audio_port>())
+    channels = std::max(channels, int(port->get().size()));
+
+  auto link = std::make_shared<Link>(m_impl->latency, audio ? channels : 0, bufferSize);
+  {
+    std::lock_guard _{m_impl->linksMutex};
+    m_impl->links[cable] = link;
+  }
+  return std::make_shared<partition_receiver>(
+      std::move(link), audio, channels, bufferSize);
+}
+
+void ExecutionPartition::removeReceiver(int32_t cable)
+{
+  std::lock_guard _{m_impl->linksMutex};
+  m_impl->links.erase(cable);
+}
+
+void ExecutionPartition::reportLatencies()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if(now - m_impl->lastReport < std::chrono::seconds(5))
+    return;
+  m_impl->lastReport = now;
+
+  {
+    std::lock_guard _{m_impl->outboxesMutex};
+    for(const auto& o : m_impl->outboxes)
+    {
+      auto outbox = o.lock();
+      if(!outbox)
+        continue;
+      if(const int64_t unsent = outbox->unsent.exchange(0))
+        qDebug() << "Execution partition: cable" << outbox->cable << unsent
+                 << "datagrams not sent, the sending thread is late";
+    }
+  }
+
+  std::lock_guard _{m_impl->linksMutex};
+  for(auto& [cable, link] : m_impl->links)
+  {
+    const int64_t n = link->frames.exchange(0);
+    const int64_t depth = link->depthSum.exchange(0);
+    const int64_t depthMax = link->depthMax.exchange(0);
+    const int64_t underruns = link->underruns.exchange(0);
+    const int64_t dropped = link->dropped.exchange(0);
+    const int64_t offset = link->offsetSum.exchange(0);
+    if(n == 0 && underruns == 0)
+      continue;
+
+    const double ms = 1000. / flicks_per_second;
+    const double frame = link->frameDuration.load() * ms;
+    qDebug() << "Execution partition: cable" << cable << "buffered"
+             << (n > 0 ? frame * depth / n : 0.) << "ms, max" << frame * depthMax
+             << "ms," << underruns << "underruns," << dropped
+             << "dropped, timeline offset" << (n > 0 ? offset * ms / n : 0.) << "ms";
+  }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <ossia/dataflow/dataflow_fwd.hpp>
+
+#include <score_lib_process_export.h>
+
+#include <memory>
+
+namespace Process
+{
+class ProcessModel;
+}
+
+namespace Execution
+{
+/**
+ * @brief Splits the execution of a document across several score instances
+ *
+ * Every instance plays the same document, with the environment variable
+ * SCORE_EXECUTION_PARTITION set to "index/count", e.g. "0/2" and "1/2".
+ *
+ * Time-independent processes (effects, generators...) are assigned to a
+ * single partition according to a hash of their path in the document, and
+ * are muted in the others, while
+ * the processes which drive the timeline run everywhere.
+ * Cables between two partitions are replaced by UDP streams carrying the
+ * audio or the values of the cable, sent to the port 9950 + index of the
+ * receiving partition, on the host given at its index in the
+ * comma-separated SCORE_EXECUTION_PARTITION_HOSTS (localhost by default).
+ *
+ * The execution only exchanges buffers allocated when the cables are set
+ * up with the threads which send and receive the datagrams. Audio cables
+ * carry the channels their source had then, and at least two.
+ *
+ * Each cable is received through a FIFO of SCORE_EXECUTION_PARTITION_LATENCY
+ * buffers (2 by default), which absorbs the jitter of the network: it is
+ * filled again after an underrun, and trimmed when the network catches up.
+ *
+ * The instances are not synchronized: they have to be started together.
+ * The latency of the FIFOs, their underruns, and the offset between the
+ * timeline of the receiving instance and the one of the sending instance
+ * are reported periodically in the debug output; the timelines being
+ * compared, the clocks of the hosts do not matter.
+ */
+class SCORE_LIB_PROCESS_EXPORT ExecutionPartition
+{
+public:
+  //! Returns nullptr if partitioning is not enabled
+  static std::shared_ptr<ExecutionPartition> instance();
+  ~ExecutionPartition();
+
+  int partition(const Process::ProcessModel& proc) const noexcept;
+  bool isLocal(const Process::ProcessModel& proc) const noexcept;
+
+  //! Node streaming what comes in its inlet to the given partition.
+  //! Returns nullptr if the port type cannot be streamed.
+  std::shared_ptr<ossia::graph_node> makeSender(
+      int32_t cable, int partition, const ossia::outlet& source, int bufferSize);
+
+  //! Node outputting what is received for the given cable.
+  //! Returns nullptr if the port type cannot be streamed.
+  std::shared_ptr<ossia::graph_node> makeReceiver(
+      int32_t cable, const ossia::outlet& source, const ossia::inlet& sink,
+      int bufferSize);
+  void removeReceiver(int32_t cable);
+
+  //! Called from the GUI thread
+  void reportLatencies();
+
+  struct Impl;
+
+private:
+  ExecutionPartition(int index, int count);
+  std::shared_ptr<Impl> m_impl;
+  int m_index{};
+  int m_count{1};
+};
+}
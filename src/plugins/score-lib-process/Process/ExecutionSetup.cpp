@@ -4,18 +4,25 @@
 #include <Process/Dataflow/Port.hpp>
 #include <Process/ExecutionContext.hpp>
 #include <Process/ExecutionFunctions.hpp>
+#include <Process/ExecutionPartition.hpp>
 #include <Process/ExecutionSetup.hpp>
 #include <Process/Process.hpp>
 
+#include <score/document/DocumentContext.hpp>
+
 #include <ossia/dataflow/execution_state.hpp>
 #include <ossia/dataflow/for_each_port.hpp>
 #include <ossia/dataflow/graph/graph_interface.hpp>
 #include <ossia/dataflow/graph_edge.hpp>
 #include <ossia/dataflow/graph_node.hpp>
 #include <ossia/dataflow/port.hpp>
+#include <ossia/detail/algorithms.hpp>
 #include <ossia/editor/scenario/time_process.hpp>
 #include <ossia/network/common/destination_qualifiers.hpp>
 
+#include <QDebug>
+#include <QTimer>
+
 namespace Execution
 {
 
@@ -74,6 +81,18 @@ void SetupContext::on_cableRemoved(const Process::Cable& c)
     context.executionQueue.enqueue(
         [cable = it->second, graph = context.execGraph] { graph->disconnect(cable); });
   }
+
+  auto node_it = m_partitionNodes.find(c.id());
+  if(node_it != m_partitionNodes.end())
+  {
+    m_partition->removeReceiver(c.id().val());
+    context.executionQueue.enqueue(
+        [node = std::move(node_it->second), graph = context.execGraph] {
+      graph->remove_node(node);
+      node->clear();
+    });
+    m_partitionNodes.erase(node_it);
+  }
 }
 
 void SetupContext::connectCable(Process::Cable& cable)
@@ -102,6 +121,53 @@ void SetupContext::connectCable(Process::Cable& cable)
     }
   }
 
+  // Cables between two instances of a partitioned execution
+  // go through a node streaming the data over the network
+  std::shared_ptr<ossia::graph_node> partition_node;
+  if(m_partition && source_node && sink_node && source_port && sink_port)
+  {
+    auto source_proc = proc_map.find(source_node.get());
+    auto sink_proc = proc_map.find(sink_node.get());
+    if(source_proc != proc_map.end() && sink_proc != proc_map.end())
+    {
+      const bool source_local = m_partition->isLocal(*source_proc->second);
+      const bool sink_local = m_partition->isLocal(*sink_proc->second);
+      if(source_local && !sink_local)
+      {
+        partition_node = m_partition->makeSender(
+            cable.id().val(), m_partition->partition(*sink_proc->second), *source_port,
+            context.execState->bufferSize);
+        if(partition_node)
+        {
+          sink_node = partition_node;
+          sink_port = partition_node->root_inputs()[0];
+        }
+      }
+      else if(!source_local && sink_local)
+      {
+        partition_node = m_partition->makeReceiver(
+            cable.id().val(), *source_port, *sink_port, context.execState->bufferSize);
+        if(partition_node)
+        {
+          source_node = partition_node;
+          source_port = partition_node->root_outputs()[0];
+        }
+      }
+
+      if(source_local != sink_local)
+      {
+        if(!partition_node)
+        {
+          qDebug() << "Execution partition: cannot stream the data of cable"
+                   << cable.id().val();
+          return;
+        }
+
+        m_partitionNodes[cable.id()] = partition_node;
+      }
+    }
+  }
+
   if(source_node && sink_node && source_port && sink_port)
   {
     ossia::edge_ptr edge;
@@ -134,7 +200,10 @@ void SetupContext::connectCable(Process::Cable& cable)
     }
 
     m_cables[cable.id()] = edge;
-    context.executionQueue.enqueue([edge, graph = context.execGraph]() mutable {
+    context.executionQueue.enqueue(
+        [edge, partition_node, graph = context.execGraph]() mutable {
+      if(partition_node)
+        graph->add_node(std::move(partition_node));
       graph->connect(std::move(edge));
     });
   }
@@ -201,11 +270,22 @@ void SetupContext::register_node_impl(
   }
 }
 
+void SetupContext::mute_if_remote(
+    const Process::ProcessModel& proc, const std::shared_ptr<ossia::graph_node>& node,
+    auto&& append)
+{
+  // Processes assigned to another instance of a partitioned execution
+  // are kept in the graph, but do not run here
+  if(m_partition && node && !m_partition->isLocal(proc))
+    append([node] { node->set_mute(true); });
+}
+
 void SetupContext::register_node(
     const Process::ProcessModel& proc, const std::shared_ptr<ossia::graph_node>& node)
 {
   register_node(proc.inlets(), proc.outlets(), node);
   proc_map[node.get()] = &proc;
+  mute_if_remote(proc, node, enqueue_in_context(*this));
 }
 
 void SetupContext::unregister_node(
@@ -221,6 +301,7 @@ void SetupContext::register_node(
 {
   register_node(proc.inlets(), proc.outlets(), node, vec);
   proc_map[node.get()] = &proc;
+  mute_if_remote(proc, node, enqueue_in_vector(vec));
 }
 
 void SetupContext::unregister_node(
@@ -615,11 +696,213 @@ void SetupContext::unregister_node_soft(
     outlets.erase(ptr);
 }
 
+auto SetupContext::findNodeChains() const -> NodeChains
+{
+  // Cables going out of and coming into each node
+  score::hash_map<const ossia::graph_node*, int> out_count, in_count;
+  for(const auto& [id, edge] : m_cables)
+  {
+    if(edge)
+    {
+      out_count[edge->out_node.get()]++;
+      in_count[edge->in_node.get()]++;
+    }
+  }
+
+  // Audio outlets propagating to the parent interval also consume the output
+  // of their node, without any cable
+  for(const auto& [node, proc] : proc_map)
+  {
+    for(auto* outlet : proc->outlets())
+    {
+      if(auto audio = qobject_cast<Process::AudioOutlet*>(outlet);
+         audio && audio->propagate())
+        out_count[node]++;
+    }
+  }
+
+  auto is_link = [&](const ossia::graph_edge& e) {
+    if(!e.con.target<ossia::immediate_strict_connection>()
+       && !e.con.target<ossia::immediate_glutton_connection>())
+      return false;
+    if(!e.out->target<ossia::audio_port>() || !e.in->target<ossia::audio_port>())
+      return false;
+    if(e.out->address || e.in->address)
+      return false;
+    if(out_count[e.out_node.get()] != 1 || in_count[e.in_node.get()] != 1)
+      return false;
+
+    // Also excludes the nodes streaming to other instances of a partitioned execution
+    auto src = proc_map.find(e.out_node.get());
+    auto snk = proc_map.find(e.in_node.get());
+    if(src == proc_map.end() || snk == proc_map.end())
+      return false;
+    if(m_partition
+       && (!m_partition->isLocal(*src->second) || !m_partition->isLocal(*snk->second)))
+      return false;
+    return true;
+  };
+
+  score::hash_map<const ossia::graph_node*, const ossia::graph_node*> next;
+  score::hash_map<const ossia::graph_node*, const ossia::graph_node*> prev;
+  score::hash_map<const ossia::graph_node*, int> channels;
+  for(const auto& [id, edge] : m_cables)
+  {
+    if(edge && is_link(*edge))
+    {
+      next[edge->out_node.get()] = edge->in_node.get();
+      prev[edge->in_node.get()] = edge->out_node.get();
+
+      // The graph copies each channel of the outlet into the inlet
+      const auto& out = *edge->out->target<ossia::audio_port>();
+      channels[edge->out_node.get()] = std::max(int(out.get().size()), 1);
+    }
+  }
+
+  NodeChains res;
+  for(const auto& [head, second] : next)
+  {
+    if(prev.contains(head))
+      continue;
+
+    auto& chain = res.chains.emplace_back();
+    chain.push_back(head);
+    for(auto it = next.find(head); it != next.end(); it = next.find(it->second))
+    {
+      res.copies += channels[it->first];
+      chain.push_back(it->second);
+      if(chain.size() > next.size() + 1)
+        break;
+    }
+
+    res.nodes += chain.size() - 1;
+  }
+  return res;
+}
+
+void SetupContext::reportNodeChains() const
+{
+  const auto res = findNodeChains();
+  qDebug() << "Execution:" << res.chains.size() << "linear chains," << res.nodes
+           << "nodes and" << res.copies << "channel copies per tick ("
+           << res.copies * context.execState->bufferSize << "samples) could be removed";
+
+  for(const auto& chain : res.chains)
+  {
+    QStringList names;
+    for(auto node : chain)
+    {
+      auto it = proc_map.find(node);
+      names.push_back(it != proc_map.end() ? it->second->prettyName() : QString{});
+    }
+    qDebug() << "  " << names.join(QStringLiteral(" -> "));
+  }
+}
+
 SetupContext::SetupContext(Context& other) noexcept
     : context{other}
+    , m_partition{ExecutionPartition::instance()}
 {
+  if(m_partition)
+    register_gui_update(this, [p = m_partition] { p->reportLatencies(); });
 }
 
 SetupContext::~SetupContext() { }
 
+void SetupContext::connect_gui_updates()
+{
+  if(!m_guiUpdatesConnection)
+  {
+    m_guiUpdatesConnection = connect(
+        &context.doc.coarseUpdateTimer, &QTimer::timeout, this,
+        &SetupContext::run_gui_updates, Qt::QueuedConnection);
+  }
+}
+
+void SetupContext::register_gui_update(QObject* owner, std::function<void()> update)
+{
+  SCORE_ASSERT(owner);
+  connect_gui_updates();
+
+  // Registering from an update must not invalidate the vector being iterated
+  auto& updates = m_runningGuiUpdates ? m_pendingGuiUpdates : m_guiUpdates;
+  updates.push_back({owner, std::move(update)});
+
+  connect(owner, &QObject::destroyed, this, [this, owner] {
+    for(auto* vec : {&m_guiUpdates, &m_pendingGuiUpdates})
+      for(auto& u : *vec)
+        if(u.owner == owner)
+          u.owner = nullptr;
+    m_removedGuiUpdates = true;
+  });
+}
+
+std::function<void()>
+SetupContext::register_notified_gui_update(QObject* owner, std::function<void()> update)
+{
+  SCORE_ASSERT(owner);
+  connect_gui_updates();
+  if(!m_notifiedGuiUpdatesPending)
+    m_notifiedGuiUpdatesPending = std::make_shared<std::atomic_bool>(false);
+
+  auto u = std::make_shared<NotifiedGuiUpdate>();
+  u->owner = owner;
+  u->update = std::move(update);
+  m_notifiedGuiUpdates.push_back(u);
+
+  connect(owner, &QObject::destroyed, this, [this] { m_removedGuiUpdates = true; });
+
+  // Only flags are set from the execution threads, the UI polls them
+  return [any = m_notifiedGuiUpdatesPending, u = std::move(u)] {
+    if(!u->pending.exchange(true, std::memory_order_acq_rel))
+      any->store(true, std::memory_order_release);
+  };
+}
+
+void SetupContext::run_gui_updates()
+{
+  auto compact = [this] {
+    if(m_removedGuiUpdates)
+    {
+      ossia::remove_erase_if(m_guiUpdates, [](const GuiUpdate& u) { return !u.owner; });
+      ossia::remove_erase_if(
+          m_notifiedGuiUpdates, [](const auto& u) { return !u->owner; });
+      m_removedGuiUpdates = false;
+    }
+  };
+
+  compact();
+
+  m_runningGuiUpdates = true;
+  for(auto& u : m_guiUpdates)
+  {
+    if(u.owner)
+      u.update();
+  }
+
+  if(m_notifiedGuiUpdatesPending
+     && m_notifiedGuiUpdatesPending->exchange(false, std::memory_order_acq_rel))
+  {
+    // By index: an update may register new ones
+    for(std::size_t i = 0; i < m_notifiedGuiUpdates.size(); i++)
+    {
+      // Cleared before running: values pushed meanwhile notify again
+      auto& u = *m_notifiedGuiUpdates[i];
+      if(u.pending.exchange(false, std::memory_order_acq_rel) && u.owner)
+        u.update();
+    }
+  }
+  m_runningGuiUpdates = false;
+
+  if(!m_pendingGuiUpdates.empty())
+  {
+    m_guiUpdates.insert(
+        m_guiUpdates.end(), std::make_move_iterator(m_pendingGuiUpdates.begin()),
+        std::make_move_iterator(m_pendingGuiUpdates.end()));
+    m_pendingGuiUpdates.clear();
+  }
+
+  compact();
+}
+
 }
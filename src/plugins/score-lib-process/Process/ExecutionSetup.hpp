@@ -9,9 +9,12 @@
 #include <ossia/detail/small_vector.hpp>
 
 #include <QMetaObject>
+#include <QPointer>
 
 #include <nano_observer.hpp>
 
+#include <atomic>
+
 namespace ossia
 {
 class time_process;
@@ -32,6 +35,7 @@ struct AddressAccessor;
 namespace Execution
 {
 struct Context;
+class ExecutionPartition;
 template <typename T>
 inline constexpr auto gc(T&& t) noexcept
 {
@@ -173,7 +177,83 @@ struct SCORE_LIB_PROCESS_EXPORT SetupContext final
       runtime_connections;
   score::hash_map<const ossia::graph_node*, const Process::ProcessModel*> proc_map;
 
+  struct NodeChains
+  {
+    std::vector<std::vector<const ossia::graph_node*>> chains;
+    //! Nodes which would disappear if each chain ran as a single node
+    int nodes{};
+    //! Channels copied by the graph at each tick from a node of a chain to the
+    //! next one, as set up in their outlets when the chains are found.
+    //! An outlet without channels yet is counted as one.
+    int copies{};
+  };
+
+  /**
+   * @brief Finds the linear chains of audio processes in the graph
+   *
+   * In a chain, each node only feeds the next one through a single
+   * immediate audio cable, and the next one only receives from it.
+   * Such chains are candidates to be executed as a single unit.
+   */
+  NodeChains findNodeChains() const;
+  void reportNodeChains() const;
+
+  /**
+   * @brief Registers a function bringing values from the engine back to the UI.
+   *
+   * All the registered functions are run from a single connection to the
+   * document's coarse update timer, instead of one queued connection per process.
+   * The function is unregistered when owner is destroyed.
+   */
+  void register_gui_update(QObject* owner, std::function<void()> update);
+
+  /**
+   * @brief Registers an update which only runs when the execution asks for it.
+   *
+   * The returned function is called from the execution threads when there
+   * are new values for the UI, e.g. as the notify of a gui_notifying_node.
+   * It only sets atomic flags: it neither allocates nor blocks.
+   * The update then runs once at the next refresh, however many times it was
+   * notified; when nothing was notified, the updates are not visited at all.
+   */
+  std::function<void()>
+  register_notified_gui_update(QObject* owner, std::function<void()> update);
+
 private:
+  void connect_gui_updates();
+  void run_gui_updates();
+
+  void mute_if_remote(
+      const Process::ProcessModel& proc, const std::shared_ptr<ossia::graph_node>& node,
+      auto&& append);
+
+  //! Set when the execution is split across several instances
+  std::shared_ptr<ExecutionPartition> m_partition;
+  //! Nodes streaming the cables going to or coming from another instance
+  score::hash_map<Id<Process::Cable>, std::shared_ptr<ossia::graph_node>>
+      m_partitionNodes;
+
+  struct GuiUpdate
+  {
+    QObject* owner{};
+    std::function<void()> update;
+  };
+  std::vector<GuiUpdate> m_guiUpdates;
+  std::vector<GuiUpdate> m_pendingGuiUpdates;
+
+  struct NotifiedGuiUpdate
+  {
+    QPointer<QObject> owner;
+    std::function<void()> update;
+    std::atomic_bool pending{};
+  };
+  std::vector<std::shared_ptr<NotifiedGuiUpdate>> m_notifiedGuiUpdates;
+  //! Set from the execution when any of the notified updates is pending
+  std::shared_ptr<std::atomic_bool> m_notifiedGuiUpdatesPending;
+  QMetaObject::Connection m_guiUpdatesConnection;
+  bool m_runningGuiUpdates{};
+  bool m_removedGuiUpdates{};
+
   template <typename Impl>
   void register_node_impl(
       const Process::Inlets& inlets, const Process::Outlets& outlets,
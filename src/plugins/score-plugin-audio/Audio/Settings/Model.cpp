@@ -41,12 +41,15 @@ SETTINGS_PARAMETER_IMPL(AutoStereo){QStringLiteral("Audio/AutoStereo"), true};
 SETTINGS_PARAMETER_IMPL(AutoConnect){QStringLiteral("Audio/AutoConnect"), true};
 SETTINGS_PARAMETER_IMPL(JackTransport){
     QStringLiteral("Audio/JackTransport"), ExternalTransport::None};
+SETTINGS_PARAMETER_IMPL(AudioCacheSize){QStringLiteral("Audio/CacheSize"), 4096};
+SETTINGS_PARAMETER_IMPL(LooperMaxLength){QStringLiteral("Audio/LooperMaxLength"), 128};
 
 static auto list()
 {
   return std::tie(
       Driver, Rate, InputNames, OutputNames, CardIn, CardOut, BufferSize, DefaultIn,
-      DefaultOut, AutoStereo, AutoConnect, JackTransport);
+      DefaultOut, AutoStereo, AutoConnect, JackTransport, AudioCacheSize,
+      LooperMaxLength);
 }
 }
 
@@ -263,4 +266,6 @@ SCORE_SETTINGS_PARAMETER_CPP(int, Model, DefaultOut)
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, AutoStereo)
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, AutoConnect)
 SCORE_SETTINGS_PARAMETER_CPP(Audio::Settings::ExternalTransport, Model, JackTransport)
+SCORE_SETTINGS_PARAMETER_CPP(int, Model, AudioCacheSize)
+SCORE_SETTINGS_PARAMETER_CPP(int, Model, LooperMaxLength)
 }
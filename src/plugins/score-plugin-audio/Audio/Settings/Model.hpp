@@ -48,6 +48,12 @@ class SCORE_PLUGIN_AUDIO_EXPORT Model : public score::SettingsDelegateModel
   // Use JACK Transport
   ExternalTransport m_JackTransport{ExternalTransport::None};
 
+  // Maximum size of the cache of decoded audio files, in megabytes
+  int m_AudioCacheSize{};
+
+  // Maximum length of the loops recorded by the loopers, in seconds
+  int m_LooperMaxLength{};
+
 public:
   Model(QSettings& set, const score::ApplicationContext& ctx);
 
@@ -66,6 +72,8 @@ public:
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_AUDIO_EXPORT, bool, AutoConnect)
   SCORE_SETTINGS_PARAMETER_HPP(
       SCORE_PLUGIN_AUDIO_EXPORT, Audio::Settings::ExternalTransport, JackTransport)
+  SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_AUDIO_EXPORT, int, AudioCacheSize)
+  SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_AUDIO_EXPORT, int, LooperMaxLength)
 };
 
 SCORE_SETTINGS_PARAMETER(Model, Driver)
@@ -80,6 +88,8 @@ SCORE_SETTINGS_DEFERRED_PARAMETER(Model, DefaultOut)
 SCORE_SETTINGS_DEFERRED_PARAMETER(Model, AutoStereo)
 SCORE_SETTINGS_DEFERRED_PARAMETER(Model, AutoConnect)
 SCORE_SETTINGS_DEFERRED_PARAMETER(Model, JackTransport)
+SCORE_SETTINGS_DEFERRED_PARAMETER(Model, AudioCacheSize)
+SCORE_SETTINGS_DEFERRED_PARAMETER(Model, LooperMaxLength)
 }
 
 Q_DECLARE_METATYPE(Audio::Settings::ExternalTransport)
@@ -27,6 +27,8 @@ Presenter::Presenter(Model& m, View& v, QObject* parent)
   v.setRate(m.getRate());
   v.setBufferSize(m.getBufferSize());
   v.setAutoStereo(m.getAutoStereo());
+  v.setAudioCacheSize(m.getAudioCacheSize());
+  v.setLooperMaxLength(m.getLooperMaxLength());
 
   con(v, &View::DriverChanged, this, [this, &m](auto val) {
     if(val != m.getDriver())
@@ -41,6 +43,18 @@ Presenter::Presenter(Model& m, View& v, QObject* parent)
       m_disp.submitDeferredCommand<SetModelAutoStereo>(m, val);
     }
   });
+  con(v, &View::AudioCacheSizeChanged, this, [this, &m](auto val) {
+    if(val != m.getAudioCacheSize())
+    {
+      m_disp.submitDeferredCommand<SetModelAudioCacheSize>(m, val);
+    }
+  });
+  con(v, &View::LooperMaxLengthChanged, this, [this, &m](auto val) {
+    if(val != m.getLooperMaxLength())
+    {
+      m_disp.submitDeferredCommand<SetModelLooperMaxLength>(m, val);
+    }
+  });
 
   con(v, &View::BufferSizeChanged, this, [this, &m](auto val) {
     if(val != m.getBufferSize())
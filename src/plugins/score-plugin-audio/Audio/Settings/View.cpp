@@ -11,6 +11,7 @@
 #include <QComboBox>
 #include <QFormLayout>
 #include <QLabel>
+#include <QSpinBox>
 namespace Audio::Settings
 {
 View::View()
@@ -20,6 +21,16 @@ View::View()
 
   // General settings
   SETTINGS_UI_TOGGLE_SETUP("Auto-Stereo", AutoStereo);
+  SETTINGS_UI_SPINBOX_SETUP("Decoded files cache (MB)", AudioCacheSize);
+  m_AudioCacheSize->setRange(0, 1024 * 1024);
+  m_AudioCacheSize->setToolTip(
+      tr("The least recently used files are removed beyond this size, 0 disables "
+         "the cache"));
+  SETTINGS_UI_SPINBOX_SETUP("Looper maximum length (s)", LooperMaxLength);
+  m_LooperMaxLength->setRange(1, 3600);
+  m_LooperMaxLength->setToolTip(
+      tr("Memory is reserved for loops of this length when a looper is created: "
+         "recording stops extending a loop beyond it"));
 
   // Driver combo-box
   m_Driver = new QComboBox{m_widg};
@@ -114,4 +125,6 @@ void View::setBufferSize(int val)
   }
 }
 SETTINGS_UI_TOGGLE_IMPL(AutoStereo)
+SETTINGS_UI_SPINBOX_IMPL(AudioCacheSize)
+SETTINGS_UI_SPINBOX_IMPL(LooperMaxLength)
 }
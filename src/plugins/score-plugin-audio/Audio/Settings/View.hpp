@@ -33,6 +33,8 @@ public:
   void RateChanged(int arg) W_SIGNAL(RateChanged, arg)
 
   SETTINGS_UI_TOGGLE_HPP(AutoStereo)
+  SETTINGS_UI_SPINBOX_HPP(AudioCacheSize)
+  SETTINGS_UI_SPINBOX_HPP(LooperMaxLength)
 
 private:
   QWidget* getWidget() override;
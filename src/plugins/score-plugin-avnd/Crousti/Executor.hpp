@@ -1,7 +1,9 @@
 #pragma once
 
+#include <Process/Execution/GuiNotifyingNode.hpp>
 #include <Process/Execution/ProcessComponent.hpp>
 #include <Process/ExecutionContext.hpp>
+#include <Process/ExecutionSetup.hpp>
 
 #include <Explorer/DocumentPlugin/DeviceDocumentPlugin.hpp>
 
@@ -473,6 +475,21 @@ struct ExecutorGuiUpdate
   }
 };
 
+//! Whether a node pushed values for the UI during its last tick
+struct HasGuiValues
+{
+  template <typename ExecNode>
+  bool operator()(const ExecNode& node) const noexcept
+  {
+    bool res = false;
+    if constexpr(requires { node.control.ins_queue.size_approx(); })
+      res |= node.control.ins_queue.size_approx() > 0;
+    if constexpr(requires { node.control.outs_queue.size_approx(); })
+      res |= node.control.outs_queue.size_approx() > 0;
+    return res;
+  }
+};
+
 template <typename T, bool Predicate>
 struct type_if;
 template <typename T>
@@ -633,7 +650,19 @@ public:
     {
       auto st = ossia::exec_state_facade{ctx.execState.get()};
       std::shared_ptr<safe_node<Node>> ptr;
-      auto node = new safe_node<Node>{st.bufferSize(), (double)st.sampleRate(), id};
+      std::function<void()>* notify{};
+      safe_node<Node>* node{};
+      if constexpr(Execution::can_notify_gui<safe_node<Node>>)
+      {
+        auto nn = new Execution::gui_notifying_node<safe_node<Node>, HasGuiValues>{
+            st.bufferSize(), (double)st.sampleRate(), id};
+        notify = &nn->notify;
+        node = nn;
+      }
+      else
+      {
+        node = new safe_node<Node>{st.bufferSize(), (double)st.sampleRate(), id};
+      }
       node->prepare(*ctx.execState.get()); // Preparation of the ossia side
 
       if_possible(node->impl.effect.ossia_state = st);
@@ -645,7 +674,7 @@ public:
 
       node->finish_init();
 
-      connect_controls(element, ctx, ptr);
+      connect_controls(element, ctx, ptr, notify);
       update_controls(ptr);
 
       // To call prepare() after evertyhing is ready
@@ -657,7 +686,7 @@ public:
 
   void connect_controls(
       ProcessModel<Node>& element, const ::Execution::Context& ctx,
-      std::shared_ptr<safe_node<Node>>& ptr)
+      std::shared_ptr<safe_node<Node>>& ptr, std::function<void()>* notify = nullptr)
   {
     using control_inputs_type = avnd::control_input_introspection<Node>;
     using curve_inputs_type = avnd::curve_input_introspection<Node>;
@@ -715,9 +744,25 @@ public:
       ExecutorGuiUpdate<Node> timer_action{weak_node, element};
       timer_action();
 
-      con(
-          ctx.doc.coarseUpdateTimer, &QTimer::timeout, this, [=] { timer_action(); },
-          Qt::QueuedConnection);
+      if(notify)
+        *notify = ctx.setup.register_notified_gui_update(this, timer_action);
+      else
+        ctx.setup.register_gui_update(this, timer_action);
+    }
+  }
+
+  //! Whether UI -> processor messages can be passed by copy in an execution command
+  static constexpr bool small_gui_message() noexcept
+  {
+    using refl = avnd::function_reflection<&Node::process_message>;
+    if constexpr(refl::count == 1)
+    {
+      using arg_type = std::decay_t<avnd::first_argument<&Node::process_message>>;
+      return std::is_trivially_copyable_v<arg_type> && sizeof(arg_type) <= 64;
+    }
+    else
+    {
+      return false;
     }
   }
 
@@ -729,38 +774,76 @@ public:
     avnd::effect_container<Node>& eff = ptr->impl;
     if constexpr(avnd::has_gui_to_processor_bus<Node>)
     {
-      element.from_ui = [p = QPointer{this}, &eff](QByteArray b) {
-        if(!p)
-          return;
-
-        p->in_exec([mess = std::move(b), &eff] {
-          using refl = avnd::function_reflection<&Node::process_message>;
-          static_assert(refl::count <= 1);
-
-          if constexpr(refl::count == 0)
-          {
-            // no arguments, just call it
-            eff.effect.process_message();
-          }
-          else if constexpr(refl::count == 1)
-          {
-            using arg_type = avnd::first_argument<&Node::process_message>;
-            std::decay_t<arg_type> arg;
-            MessageBusReader b{mess};
-            b(arg);
+      if constexpr(small_gui_message())
+      {
+        // Small messages are deserialized here and copied in the command,
+        // so that nothing gets allocated or freed in the audio thread
+        using arg_type = std::decay_t<avnd::first_argument<&Node::process_message>>;
+        element.from_ui = [p = QPointer{this}, &eff](QByteArray b) {
+          if(!p)
+            return;
+
+          arg_type arg;
+          MessageBusReader{b}(arg);
+          p->in_exec([arg, &eff]() mutable {
             eff.effect.process_message(std::move(arg));
-          }
-        });
-      };
+          });
+        };
+      }
+      else
+      {
+        element.from_ui = [p = QPointer{this}, &eff](QByteArray b) {
+          if(!p)
+            return;
+
+          p->in_exec([mess = std::move(b), &eff] {
+            using refl = avnd::function_reflection<&Node::process_message>;
+            static_assert(refl::count <= 1);
+
+            if constexpr(refl::count == 0)
+            {
+              // no arguments, just call it
+              eff.effect.process_message();
+            }
+            else if constexpr(refl::count == 1)
+            {
+              using arg_type = avnd::first_argument<&Node::process_message>;
+              std::decay_t<arg_type> arg;
+              MessageBusReader b{mess};
+              b(arg);
+              eff.effect.process_message(std::move(arg));
+            }
+          });
+        };
+      }
     }
 
     if constexpr(avnd::has_processor_to_gui_bus<Node>)
     {
-      eff.effect.send_message = [this](auto b) mutable {
-        this->in_edit([this, bb = std::move(b)]() mutable {
-          MessageBusSender{this->process().to_ui}(std::move(bb));
+      using bus_type = std::decay_t<decltype(eff.effect.send_message)>;
+      if constexpr(requires { typename message_bus_argument<bus_type>::type; })
+      {
+        // Messages are moved into a preallocated queue in the audio thread,
+        // and serialized for the UI at the next UI update
+        using message_type = typename message_bus_argument<bus_type>::type;
+        auto queue = std::make_shared<MessageBusQueue<message_type>>();
+        eff.effect.send_message
+            = [queue](message_type b) mutable { queue->push(std::move(b)); };
+
+        ctx.setup.register_gui_update(this, [this, queue] {
+          queue->drain([this](message_type& msg) {
+            MessageBusSender{this->process().to_ui}(msg);
+          });
         });
-      };
+      }
+      else
+      {
+        eff.effect.send_message = [this](auto b) mutable {
+          this->in_edit([this, bb = std::move(b)]() mutable {
+            MessageBusSender{this->process().to_ui}(std::move(bb));
+          });
+        };
+      }
     }
   }
 
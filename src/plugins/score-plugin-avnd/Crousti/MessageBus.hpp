@@ -3,9 +3,67 @@
 
 #include <boost/pfr.hpp>
 
+#include <array>
+#include <atomic>
+#include <functional>
+
 namespace oscr
 {
 
+//! Type of the message sent through a std::function<void(T)> bus
+template <typename T>
+struct message_bus_argument;
+template <typename R, typename Arg>
+struct message_bus_argument<std::function<R(Arg)>>
+{
+  using type = std::decay_t<Arg>;
+};
+
+/**
+ * @brief Preallocated single-producer / single-consumer queue of messages.
+ *
+ * Used to send messages from the processor to the UI without allocating
+ * in the audio thread: messages are moved into slots allocated beforehand,
+ * and dropped if the UI did not keep up and the queue is full.
+ */
+template <typename T, std::size_t N = 16>
+class MessageBusQueue
+{
+public:
+  //! Called from the processor thread
+  bool push(T&& msg) noexcept(std::is_nothrow_move_assignable_v<T>)
+  {
+    const auto w = m_write.load(std::memory_order_relaxed);
+    const auto next = (w + 1) % N;
+    if(next == m_read.load(std::memory_order_acquire))
+      return false;
+
+    m_slots[w] = std::move(msg);
+    m_write.store(next, std::memory_order_release);
+    return true;
+  }
+
+  //! Called from the UI thread
+  template <typename F>
+  void drain(F&& f)
+  {
+    auto r = m_read.load(std::memory_order_relaxed);
+    const auto w = m_write.load(std::memory_order_acquire);
+    while(r != w)
+    {
+      T msg = std::move(m_slots[r]);
+      r = (r + 1) % N;
+      m_read.store(r, std::memory_order_release);
+      f(msg);
+    }
+  }
+
+private:
+  std::array<T, N> m_slots{};
+  alignas(64) std::atomic<std::size_t> m_write{};
+  alignas(64) std::atomic<std::size_t> m_read{};
+};
+
 struct Serializer
 {
   DataStreamReader& r;
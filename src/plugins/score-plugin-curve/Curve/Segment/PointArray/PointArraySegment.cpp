@@ -98,6 +98,26 @@ double PointArraySegment::valueAt(double x) const
 }
 
 void PointArraySegment::addPoint(double x, double y)
+{
+  addPointImpl(x, y);
+
+  m_valid = false;
+  dataChanged();
+}
+
+void PointArraySegment::addPoints(const std::vector<std::pair<double, double>>& pts)
+{
+  if(pts.empty())
+    return;
+
+  for(const auto& [x, y] : pts)
+    addPointImpl(x, y);
+
+  m_valid = false;
+  dataChanged();
+}
+
+void PointArraySegment::addPointImpl(double x, double y)
 {
   // If x < start.x() or x > end.x(), we update start / end
   // The points must keep their apparent position.
@@ -130,9 +150,6 @@ void PointArraySegment::addPoint(double x, double y)
   }
 
   m_points[x] = y;
-
-  m_valid = false;
-  dataChanged();
 }
 
 void PointArraySegment::addPointUnscaled(double x, double y)
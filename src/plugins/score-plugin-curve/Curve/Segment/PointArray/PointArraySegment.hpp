@@ -73,6 +73,8 @@ public:
   double valueAt(double x) const override;
 
   void addPoint(double, double);
+  //! Adds a batch of points and notifies the views only once
+  void addPoints(const std::vector<std::pair<double, double>>&);
   void addPointUnscaled(double, double);
   void simplify(double ratio); // 10 is a good ratio
   std::vector<SegmentData> toLinearSegments() const;
@@ -111,6 +113,8 @@ public:
   void maxChanged(double arg_1) E_SIGNAL(SCORE_PLUGIN_CURVE_EXPORT, maxChanged, arg_1)
 
 private:
+  void addPointImpl(double, double);
+
   // Coordinates in {x, y}.
   double min_x{}, max_x{};
   double min_y{}, max_y{};
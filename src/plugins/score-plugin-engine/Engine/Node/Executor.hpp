@@ -1,6 +1,8 @@
 #pragma once
+#include <Process/Execution/GuiNotifyingNode.hpp>
 #include <Process/Execution/ProcessComponent.hpp>
 #include <Process/ExecutionContext.hpp>
+#include <Process/ExecutionSetup.hpp>
 
 #include <Explorer/DeviceList.hpp>
 #include <Explorer/DocumentPlugin/DeviceDocumentPlugin.hpp>
@@ -109,11 +111,21 @@ struct setup_Impl0
   }
 };
 
+//! Returns true if the value differs from the one last sent to the UI
+inline bool update_last_value(ossia::value& last, const ossia::value& v)
+{
+  if(v.get_type() != ossia::val_type::IMPULSE && v == last)
+    return false;
+  last = v;
+  return true;
+}
+
 template <typename Info, typename Element, typename Node_T>
 struct setup_Impl1
 {
   typename Node_T::controls_values_type& arr;
   Element& element;
+  ossia::value* last;
 
   template <typename T>
   void operator()(T)
@@ -123,7 +135,9 @@ struct setup_Impl1
     using namespace tuplet;
     constexpr const auto ctrl = tuplet::get<T::value>(Info::Metadata::controls);
 
-    element.setControl(T::value, ctrl.toValue(get<T::value>(arr)));
+    ossia::value v = ctrl.toValue(get<T::value>(arr));
+    if(update_last_value(last[T::value], v))
+      element.setControl(T::value, std::move(v));
   }
 };
 
@@ -132,6 +146,7 @@ struct setup_Impl1_Out
 {
   typename Node_T::control_outs_values_type& arr;
   Element& element;
+  ossia::value* last;
 
   template <typename T>
   void operator()(T)
@@ -141,7 +156,9 @@ struct setup_Impl1_Out
     using namespace tuplet;
     constexpr const auto ctrl = tuplet::get<T::value>(Info::Metadata::control_outs);
 
-    element.setControlOut(T::value, ctrl.toValue(get<T::value>(arr)));
+    ossia::value v = ctrl.toValue(get<T::value>(arr));
+    if(update_last_value(last[T::value], v))
+      element.setControlOut(T::value, std::move(v));
   }
 };
 
@@ -151,6 +168,12 @@ struct ExecutorGuiUpdate
   std::weak_ptr<Node_T> weak_node;
   Element_T& element;
 
+  // Values last sent to the UI: only the controls which changed are updated
+  std::shared_ptr<ossia::value[]> last_controls{
+      new ossia::value[ossia::safe_nodes::info_functions<Info>::control_count]};
+  std::shared_ptr<ossia::value[]> last_control_outs{
+      new ossia::value[ossia::safe_nodes::info_functions<Info>::control_out_count]};
+
   void handle_controls(Node_T& node) const noexcept
   {
     using namespace ossia::safe_nodes;
@@ -167,7 +190,7 @@ struct ExecutorGuiUpdate
       constexpr const auto control_count = info_functions<Info>::control_count;
 
       ossia::for_each_in_range<control_count>(
-          setup_Impl1<Info, Element_T, Node_T>{arr, element});
+          setup_Impl1<Info, Element_T, Node_T>{arr, element, last_controls.get()});
     }
   }
 
@@ -187,7 +210,8 @@ struct ExecutorGuiUpdate
       constexpr const auto control_out_count = info_functions<Info>::control_out_count;
 
       ossia::for_each_in_range<control_out_count>(
-          setup_Impl1_Out<Info, Element_T, Node_T>{arr, element});
+          setup_Impl1_Out<Info, Element_T, Node_T>{
+              arr, element, last_control_outs.get()});
     }
   }
 
@@ -205,10 +229,30 @@ struct ExecutorGuiUpdate
   }
 };
 
+//! Whether a safe_node pushed values for the UI during its last tick
+struct has_gui_values
+{
+  template <typename Node_T>
+  bool operator()(const Node_T& node) const noexcept
+  {
+    bool res = false;
+    if constexpr(requires { node.cqueue.size_approx(); })
+      res |= node.cqueue.size_approx() > 0;
+    if constexpr(requires { node.control_outs_queue.size_approx(); })
+      res |= node.control_outs_queue.size_approx() > 0;
+    return res;
+  }
+};
+
+/**
+ * If notify is set, the node calls it when it has values for the UI
+ * and only then the UI is updated; otherwise the node is polled.
+ */
 template <typename Info, typename Node_T, typename Element_T>
 void setup_node(
     const std::shared_ptr<Node_T>& node_ptr, Element_T& element,
-    const Execution::Context& ctx, QObject* parent)
+    const Execution::Context& ctx, QObject* parent,
+    std::function<void()>* notify = nullptr)
 {
   using namespace ossia::safe_nodes;
 
@@ -228,9 +272,29 @@ void setup_node(
   {
     // Update the value in the UI
     std::weak_ptr<Node_T> weak_node = node_ptr;
-    con(ctx.doc.coarseUpdateTimer, &QTimer::timeout, parent,
-        ExecutorGuiUpdate<Info, Node_T, Element_T>{weak_node, element},
-        Qt::QueuedConnection);
+    ExecutorGuiUpdate<Info, Node_T, Element_T> update{weak_node, element};
+
+    // A value set from the UI replaces the one last sent by the engine:
+    // the engine sending that value again has to update the UI again
+    if constexpr(info_functions<Info>::control_count > 0)
+    {
+      constexpr auto control_start = info_functions<Info>::control_start;
+      for(int i = 0; i < info_functions<Info>::control_count; i++)
+      {
+        auto inlet
+            = static_cast<Process::ControlInlet*>(element.inlets()[control_start + i]);
+        QObject::connect(
+            inlet, &Process::ControlInlet::valueChanged, parent,
+            [last = update.last_controls, i](const ossia::value&) {
+          last[i] = ossia::value{};
+        });
+      }
+    }
+
+    if(notify)
+      *notify = ctx.setup.register_notified_gui_update(parent, std::move(update));
+    else
+      ctx.setup.register_gui_update(parent, std::move(update));
   }
 }
 
@@ -256,13 +320,24 @@ public:
       : Execution::ProcessComponent_T<ControlProcess<Info>, ossia::node_process>{
           element, ctx, "Executor::ControlProcess<Info>", parent}
   {
-    std::shared_ptr<ossia::safe_nodes::safe_node<Info>> n{
-        new ossia::safe_nodes::safe_node<Info>};
+    using node_type = ossia::safe_nodes::safe_node<Info>;
+    std::shared_ptr<node_type> n;
+    std::function<void()>* notify{};
+    if constexpr(Execution::can_notify_gui<node_type>)
+    {
+      auto nn = new Execution::gui_notifying_node<node_type, has_gui_values>;
+      notify = &nn->notify;
+      n.reset(nn);
+    }
+    else
+    {
+      n.reset(new node_type);
+    }
     n->prepare(*ctx.execState.get());
     this->node = n;
     this->m_ossia_process = std::make_shared<ossia::node_process>(this->node);
 
-    setup_node<Info>(n, element, ctx, this);
+    setup_node<Info>(n, element, ctx, this, notify);
   }
 
   ~Executor() { }
@@ -12,7 +12,9 @@
 #include <Audio/AudioApplicationPlugin.hpp>
 #include <Audio/AudioTick.hpp>
 #include <Audio/Settings/Model.hpp>
+#include <Execution/ExecutionThreads.hpp>
 #include <Execution/ExecutionTick.hpp>
+#include <Execution/InputTrace.hpp>
 #include <Execution/Settings/ExecutorModel.hpp>
 
 #include <ossia/audio/audio_parameter.hpp>
@@ -74,6 +76,36 @@ void Clock::play_impl(const TimeVal& t)
 
   m_pause_tick = Audio::makePauseTick(this->context.doc.app);
 
+  if(auto threads = Execution::ThreadConfiguration::fromSettings(m_plug.settings);
+     !threads.cores.empty() || threads.realtime)
+  {
+    auto ticks = Execution::makeConfiguredTicks(
+        std::move(m_play_tick), std::move(m_pause_tick), std::move(threads));
+    m_play_tick = std::move(ticks.play);
+    m_pause_tick = std::move(ticks.pause);
+  }
+
+#if !defined(SCORE_DEPLOYMENT_BUILD)
+  // Debug helpers to reproduce an execution with the exact same input
+  auto& devices = context.doc.plugin<Explorer::DeviceDocumentPlugin>();
+  if(auto path = qEnvironmentVariable("SCORE_INPUT_TRACE_REPLAY"); !path.isEmpty())
+  {
+    const auto& st = *m_plug.contextData()->execState;
+    auto player = std::make_shared<Execution::InputTracePlayer>();
+    if(player->load(devices, path, st.sampleRate, st.bufferSize))
+    {
+      m_player = player;
+      m_play_tick = Execution::makeReplayTick(std::move(m_play_tick), std::move(player));
+    }
+  }
+  else if(auto path = qEnvironmentVariable("SCORE_INPUT_TRACE_RECORD"); !path.isEmpty())
+  {
+    m_recorder = std::make_shared<Execution::InputTraceRecorder>(
+        devices, path, m_plug.contextData()->execState->sampleRate);
+    m_play_tick = Execution::makeRecordingTick(std::move(m_play_tick), m_recorder);
+  }
+#endif
+
   resume_impl();
 }
 
@@ -104,6 +136,18 @@ void Clock::stop_impl()
   if(auto e = m_audio.audio.get())
     e->set_tick(ossia::audio_engine::fun_type{m_pause_tick});
 
+  if(m_player)
+  {
+    m_player->finish();
+    m_player.reset();
+  }
+
+  if(m_recorder)
+  {
+    m_recorder->finish();
+    m_recorder.reset();
+  }
+
   m_default.stop(*this->scenario);
   m_plug.finished();
 }
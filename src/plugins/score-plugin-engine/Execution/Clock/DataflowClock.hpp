@@ -11,6 +11,11 @@ namespace Process
 {
 class Cable;
 }
+namespace Execution
+{
+class InputTracePlayer;
+class InputTraceRecorder;
+}
 namespace Dataflow
 {
 class DocumentPlugin;
@@ -38,6 +43,8 @@ private:
 
   ossia::audio_engine::fun_type m_play_tick{};
   ossia::audio_engine::fun_type m_pause_tick{};
+  std::shared_ptr<Execution::InputTracePlayer> m_player;
+  std::shared_ptr<Execution::InputTraceRecorder> m_recorder;
 };
 
 class ClockFactory final : public Execution::ClockFactory
@@ -0,0 +1,109 @@
+#include "OfflineClock.hpp"
+
+#include <Scenario/Document/Interval/IntervalExecution.hpp>
+#include <Scenario/Document/Interval/IntervalModel.hpp>
+
+#include <Engine/ApplicationPlugin.hpp>
+#include <Execution/BaseScenarioComponent.hpp>
+#include <Execution/DocumentPlugin.hpp>
+#include <Process/ExecutionAction.hpp>
+
+#include <score/application/GUIApplicationContext.hpp>
+
+#include <ossia/dataflow/execution_state.hpp>
+#include <ossia/detail/logger.hpp>
+
+#include <QCoreApplication>
+
+#include <chrono>
+
+namespace Execution
+{
+OfflineClock::OfflineClock(const Execution::Context& ctx)
+    : ThreadedClock{ctx}
+{
+}
+
+OfflineClock::~OfflineClock()
+{
+  join();
+}
+
+void OfflineClock::starting(const TimeVal& t)
+{
+  const auto& itv = this->scenario->baseInterval().scoreInterval();
+  const auto dur = itv.duration.defaultDuration() - t;
+  m_duration = dur.infinite() ? -1. : dur.msec() / 1000.;
+
+  for(auto act : m_plug.actions())
+    act->offlineStarted();
+}
+
+void OfflineClock::stopping()
+{
+  // The last tick may be waiting for an output
+  for(auto act : m_plug.actions())
+    act->offlineStopped();
+}
+
+void OfflineClock::run()
+{
+  const auto& st = *m_plug.contextData()->execState;
+  const uint64_t frames = st.bufferSize;
+  const double period = double(frames) / double(st.sampleRate);
+
+  ossia::audio_tick_state t{};
+  t.frames = frames;
+
+  const auto start = std::chrono::steady_clock::now();
+  while(m_running)
+  {
+    if(m_paused)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      continue;
+    }
+
+    m_tick(t);
+    t.seconds += period;
+
+    if(m_duration >= 0. && t.seconds >= m_duration)
+    {
+      const double elapsed
+          = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                .count();
+      ossia::logger().info(
+          "Offline execution: {:.3f}s rendered in {:.3f}s", t.seconds, elapsed);
+
+      // Stopping joins this thread thus has to be done from the main thread
+      auto& app = context.doc.app;
+      QMetaObject::invokeMethod(qApp, [&app] {
+        app.guiApplicationPlugin<Engine::ApplicationPlugin>().execution().request_stop();
+      });
+      return;
+    }
+  }
+}
+
+std::unique_ptr<Execution::Clock> OfflineClockFactory::make(const Execution::Context& ctx)
+{
+  return std::make_unique<OfflineClock>(ctx);
+}
+
+Execution::time_function
+OfflineClockFactory::makeTimeFunction(const score::DocumentContext& ctx) const
+{
+  return [=](const TimeVal& v) -> ossia::time_value { return v; };
+}
+
+Execution::reverse_time_function
+OfflineClockFactory::makeReverseTimeFunction(const score::DocumentContext& ctx) const
+{
+  return [=](const ossia::time_value& v) -> TimeVal { return v; };
+}
+
+QString OfflineClockFactory::prettyName() const
+{
+  return QObject::tr("Offline (as fast as possible)");
+}
+}
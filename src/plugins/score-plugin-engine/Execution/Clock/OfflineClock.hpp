@@ -0,0 +1,45 @@
+#pragma once
+#include <Execution/Clock/ThreadedClock.hpp>
+
+namespace Execution
+{
+/**
+ * @brief Runs the execution as fast as possible, without audio I/O
+ *
+ * The ticks follow each other at the buffer size and sample rate of the
+ * execution settings, without waiting for the wall clock: the time seen by
+ * the processes is only the one of the ticks.
+ * Outputs which need to be rendered in lockstep with the execution,
+ * such as the video export, block the tick while they catch up: the
+ * execution actions are told when this clock starts and stops for that.
+ *
+ * The execution stops once the duration of the root interval is reached.
+ */
+class OfflineClock final : public Execution::ThreadedClock
+{
+public:
+  OfflineClock(const Execution::Context& ctx);
+  ~OfflineClock() override;
+
+private:
+  void starting(const TimeVal& t) override;
+  void stopping() override;
+  void run() override;
+
+  double m_duration{-1.};
+};
+
+class OfflineClockFactory final : public Execution::ClockFactory
+{
+  SCORE_CONCRETE("4dd3ad74-4f5f-46c6-a6c1-7c6b06da5b21")
+
+public:
+  QString prettyName() const override;
+  std::unique_ptr<Execution::Clock> make(const Execution::Context& ctx) override;
+
+  Execution::time_function
+  makeTimeFunction(const score::DocumentContext& ctx) const override;
+  Execution::reverse_time_function
+  makeReverseTimeFunction(const score::DocumentContext& ctx) const override;
+};
+}
@@ -0,0 +1,71 @@
+#include "ThreadedClock.hpp"
+
+#include <Execution/BaseScenarioComponent.hpp>
+#include <Execution/DocumentPlugin.hpp>
+
+namespace Execution
+{
+ThreadedClock::ThreadedClock(const Execution::Context& ctx)
+    : Execution::Clock{ctx}
+    , m_default{ctx}
+    , m_plug{ctx.doc.plugin<Execution::DocumentPlugin>()}
+{
+}
+
+ThreadedClock::~ThreadedClock()
+{
+  join();
+}
+
+void ThreadedClock::starting(const TimeVal& t) { }
+
+void ThreadedClock::stopping() { }
+
+void ThreadedClock::play_impl(const TimeVal& t)
+{
+  m_default.play(t, *this->scenario);
+
+  m_tick = Execution::makeExecutionTick({}, m_plug, this->scenario, false);
+  m_paused = false;
+  m_running = true;
+
+  starting(t);
+  m_thread = std::thread{[this] { run(); }};
+}
+
+void ThreadedClock::pause_impl()
+{
+  m_paused = true;
+  m_default.pause(*this->scenario);
+}
+
+void ThreadedClock::resume_impl()
+{
+  m_default.resume(*this->scenario);
+  m_paused = false;
+}
+
+void ThreadedClock::stop_impl()
+{
+  join();
+  m_tick = {};
+
+  m_default.stop(*this->scenario);
+  m_plug.finished();
+}
+
+bool ThreadedClock::paused() const
+{
+  return m_paused;
+}
+
+void ThreadedClock::join()
+{
+  m_running = false;
+  if(m_thread.joinable())
+  {
+    stopping();
+    m_thread.join();
+  }
+}
+}
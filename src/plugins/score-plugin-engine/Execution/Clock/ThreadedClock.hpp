@@ -0,0 +1,56 @@
+#pragma once
+#include <Execution/Clock/ClockFactory.hpp>
+#include <Execution/Clock/DefaultClock.hpp>
+#include <Execution/ExecutionTick.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace Execution
+{
+class DocumentPlugin;
+
+/**
+ * @brief Base for the clocks which tick the execution on a thread of their
+ * own, without audio I/O
+ *
+ * The tick only runs the execution actions of the document: the ones of the
+ * application are ticked by the audio engine.
+ * Derived classes have to call join() in their destructor, as the execution
+ * thread runs their run() and their stopping() is called before joining it.
+ */
+class SCORE_PLUGIN_ENGINE_EXPORT ThreadedClock : public Execution::Clock
+{
+public:
+  ThreadedClock(const Execution::Context& ctx);
+  ~ThreadedClock() override;
+
+protected:
+  //! Execution thread: ticks m_tick until m_running becomes false
+  virtual void run() = 0;
+
+  //! GUI thread, before the execution thread is started
+  virtual void starting(const TimeVal& t);
+
+  //! GUI thread, before the execution thread is joined
+  virtual void stopping();
+
+  void join();
+
+  Execution::DefaultClock m_default;
+  Execution::DocumentPlugin& m_plug;
+
+  Execution::tick_fun m_tick;
+  std::atomic_bool m_running{};
+  std::atomic_bool m_paused{};
+
+private:
+  void play_impl(const TimeVal& t) final override;
+  void pause_impl() final override;
+  void resume_impl() final override;
+  void stop_impl() final override;
+  bool paused() const final override;
+
+  std::thread m_thread;
+};
+}
@@ -17,6 +17,7 @@
 #include <Audio/AudioDevice.hpp>
 #include <Audio/Settings/Model.hpp>
 #include <Engine/ApplicationPlugin.hpp>
+#include <Execution/ExecutionThreads.hpp>
 #include <Execution/Settings/ExecutorModel.hpp>
 
 #include <score/actions/ActionManager.hpp>
@@ -242,9 +243,10 @@ void DocumentPlugin::makeGraph()
     p.release(std::move(v));
   }
 
+  const auto threads = ThreadConfiguration::fromSettings(settings);
   ossia::graph_setup_options opt;
   opt.parallel = settings.getParallel();
-  opt.parallel_threads = settings.getThreads();
+  opt.parallel_threads = threads.workers(settings.getThreads());
   if(settings.getLogging())
     opt.log = ossia::logger_ptr();
   if(settings.getBench())
@@ -264,7 +266,17 @@ void DocumentPlugin::makeGraph()
     opt.scheduling = ossia::graph_setup_options::Dynamic;
 
   opt.scheduling = ossia::graph_setup_options::StaticFixed;
-  execGraph = ossia::make_graph(opt);
+
+  if(opt.parallel && (!threads.cores.empty() || threads.realtime))
+  {
+    // The workers of the parallel graph are started with it and inherit
+    // the placement of the thread creating them
+    runInWorkerConfiguration(threads, [&] { execGraph = ossia::make_graph(opt); });
+  }
+  else
+  {
+    execGraph = ossia::make_graph(opt);
+  }
 }
 
 void DocumentPlugin::reload(Scenario::IntervalModel& cst)
@@ -307,6 +319,11 @@ void DocumentPlugin::reload(Scenario::IntervalModel& cst)
     m_ctxData->setupContext.connectCable(cable);
   }
 
+#if !defined(SCORE_DEPLOYMENT_BUILD)
+  if(qEnvironmentVariableIsSet("SCORE_EXECUTION_CHAINS"))
+    m_ctxData->setupContext.reportNodeChains();
+#endif
+
   for(auto ctl : model.statesWithControls)
   {
     auto state_comp
@@ -0,0 +1,281 @@
+#include "ExecutionThreads.hpp"
+
+#include <Execution/Settings/ExecutorModel.hpp>
+
+#include <ossia/detail/algorithms.hpp>
+#include <ossia/detail/logger.hpp>
+
+#include <QFile>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Execution
+{
+namespace
+{
+#if defined(__linux__)
+// Below the usual priority of the audio driver threads
+static constexpr int realtime_priority = 70;
+#endif
+
+void appendCores(const QString& str, std::vector<int>& cores, int depth)
+{
+  auto add = [&](int core) {
+    if(core >= 0 && ossia::find(cores, core) == cores.end())
+      cores.push_back(core);
+  };
+
+  for(const QString& part : str.split(',', Qt::SkipEmptyParts))
+  {
+    const auto item = part.trimmed();
+    if(item.startsWith(QStringLiteral("node:")))
+    {
+      // The kernel gives the cores of a NUMA node in the same format
+      QFile f{QStringLiteral("/sys/devices/system/node/node%1/cpulist")
+                  .arg(item.mid(5).toInt())};
+      if(depth == 0 && f.open(QIODevice::ReadOnly))
+        appendCores(QString::fromLatin1(f.readAll()), cores, depth + 1);
+      else
+        ossia::logger().warn("Execution: unknown NUMA node {}", item.toStdString());
+    }
+    else if(auto idx = item.indexOf('-'); idx > 0)
+    {
+      bool ok1{}, ok2{};
+      const int first = item.left(idx).toInt(&ok1);
+      const int last = item.mid(idx + 1).toInt(&ok2);
+      if(ok1 && ok2)
+        for(int core = first; core <= last; core++)
+          add(core);
+    }
+    else
+    {
+      bool ok{};
+      const int core = item.toInt(&ok);
+      if(ok)
+        add(core);
+    }
+  }
+}
+}
+
+std::vector<int> parseCoreList(const QString& str)
+{
+  std::vector<int> cores;
+  appendCores(str, cores, 0);
+  return cores;
+}
+
+ThreadConfiguration ThreadConfiguration::fromSettings(const Settings::Model& settings)
+{
+  ThreadConfiguration conf;
+  conf.cores = parseCoreList(settings.getAffinity());
+  conf.realtime = settings.getRealtime();
+  conf.spin = std::chrono::microseconds{settings.getSpin()};
+  return conf;
+}
+
+int ThreadConfiguration::workers(int requested) const noexcept
+{
+  if(cores.empty())
+    return requested;
+
+  // The first core is kept for the audio tick
+  return std::clamp(int(cores.size()) - 1, 1, std::max(requested, 1));
+}
+
+std::vector<int> ThreadConfiguration::workerCores() const
+{
+  if(cores.size() <= 1)
+    return cores;
+  return {cores.begin() + 1, cores.end()};
+}
+
+bool pinCurrentThread(const std::vector<int>& cores)
+{
+  if(cores.empty())
+    return true;
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for(int core : cores)
+    if(core < CPU_SETSIZE)
+      CPU_SET(core, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  return false;
+#endif
+}
+
+bool pinCurrentThread(int core) noexcept
+{
+#if defined(__linux__)
+  if(core < 0 || core >= CPU_SETSIZE)
+    return false;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  return false;
+#endif
+}
+
+bool setCurrentThreadRealtime(bool realtime)
+{
+#if defined(__linux__)
+  sched_param param{};
+  int policy{};
+  if(realtime && pthread_getschedparam(pthread_self(), &policy, &param) == 0)
+  {
+    // Audio drivers may already have given a higher priority to their thread
+    if(policy != SCHED_OTHER && param.sched_priority >= realtime_priority)
+      return true;
+  }
+
+  param.sched_priority = realtime ? std::min(
+                             realtime_priority, sched_get_priority_max(SCHED_FIFO))
+                                  : 0;
+  return pthread_setschedparam(
+             pthread_self(), realtime ? SCHED_FIFO : SCHED_OTHER, &param)
+         == 0;
+#else
+  return !realtime;
+#endif
+}
+
+void waitUntil(
+    std::chrono::steady_clock::time_point deadline, std::chrono::microseconds spin)
+{
+  // Waking up from sleep can take longer than a buffer on a loaded system,
+  // thus the last part of the wait is spent polling the clock
+  if(spin.count() > 0)
+  {
+    std::this_thread::sleep_until(deadline - spin);
+    while(std::chrono::steady_clock::now() < deadline)
+      std::this_thread::yield();
+  }
+  else
+  {
+    std::this_thread::sleep_until(deadline);
+  }
+}
+
+void configureTickThread(const ThreadConfiguration& conf)
+{
+  if(!conf.cores.empty())
+    pinCurrentThread(conf.cores.front());
+  if(conf.realtime)
+    setCurrentThreadRealtime(true);
+}
+
+SavedThreadState::SavedThreadState()
+{
+  m_cores.reserve(std::max(std::thread::hardware_concurrency(), 1u));
+}
+
+void SavedThreadState::save(const ThreadConfiguration& conf) noexcept
+{
+  m_cores.clear();
+  m_policy = -1;
+#if defined(__linux__)
+  if(!conf.cores.empty())
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0)
+    {
+      for(int i = 0; i < CPU_SETSIZE && m_cores.size() < m_cores.capacity(); i++)
+        if(CPU_ISSET(i, &set))
+          m_cores.push_back(i);
+    }
+  }
+
+  if(conf.realtime)
+  {
+    sched_param param{};
+    if(pthread_getschedparam(pthread_self(), &m_policy, &param) == 0)
+      m_priority = param.sched_priority;
+    else
+      m_policy = -1;
+  }
+#endif
+}
+
+void SavedThreadState::restore() noexcept
+{
+#if defined(__linux__)
+  if(!m_cores.empty())
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(int core : m_cores)
+      CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  }
+
+  if(m_policy != -1)
+  {
+    sched_param param{};
+    param.sched_priority = m_priority;
+    pthread_setschedparam(pthread_self(), m_policy, &param);
+  }
+#endif
+  m_cores.clear();
+  m_policy = -1;
+}
+
+void runInWorkerConfiguration(const ThreadConfiguration& conf, std::function<void()> f)
+{
+  std::thread t{[&conf, &f] {
+    if(!pinCurrentThread(conf.workerCores()))
+      ossia::logger().warn("Execution: could not pin the execution threads");
+
+    if(conf.realtime && !setCurrentThreadRealtime(true))
+      ossia::logger().warn(
+          "Execution: could not set the realtime priority of the execution threads");
+
+    f();
+  }};
+  t.join();
+}
+
+ConfiguredTicks makeConfiguredTicks(tick_fun play, tick_fun pause, ThreadConfiguration conf)
+{
+  struct configured_ticks
+  {
+    tick_fun play;
+    tick_fun pause;
+    ThreadConfiguration conf;
+    SavedThreadState previous;
+    std::atomic_bool applied{};
+  };
+
+  auto t = std::make_shared<configured_ticks>();
+  t->play = std::move(play);
+  t->pause = std::move(pause);
+  t->conf = std::move(conf);
+
+  ConfiguredTicks res;
+  res.play = [t](const ossia::audio_tick_state& st) {
+    if(!t->applied.exchange(true))
+    {
+      t->previous.save(t->conf);
+      configureTickThread(t->conf);
+    }
+    t->play(st);
+  };
+  res.pause = [t](const ossia::audio_tick_state& st) {
+    if(t->applied.exchange(false))
+      t->previous.restore();
+    t->pause(st);
+  };
+  return res;
+}
+}
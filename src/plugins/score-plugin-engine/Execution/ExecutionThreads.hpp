@@ -0,0 +1,119 @@
+#pragma once
+#include <Execution/ExecutionTick.hpp>
+
+#include <QString>
+
+#include <score_plugin_engine_export.h>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace Execution
+{
+namespace Settings
+{
+class Model;
+}
+
+/**
+ * @brief Placement of the execution threads on the machine
+ *
+ * The cores are given as a list such as "0-3,8,10-11",
+ * where "node:N" stands for all the cores of the NUMA node N.
+ * The first core runs the audio tick, the others are used by the workers
+ * of the parallel graph. How the nodes are spread on these workers is left
+ * to libossia: they are not balanced according to their cost.
+ */
+struct SCORE_PLUGIN_ENGINE_EXPORT ThreadConfiguration
+{
+  std::vector<int> cores;
+
+  //! Use SCHED_FIFO for the execution threads
+  bool realtime{};
+
+  //! Busy-wait instead of sleeping this long before a deadline
+  std::chrono::microseconds spin{};
+
+  static ThreadConfiguration fromSettings(const Settings::Model& settings);
+
+  //! Number of parallel workers which fit on the selected cores
+  int workers(int requested) const noexcept;
+
+  //! Cores left to the parallel workers
+  std::vector<int> workerCores() const;
+};
+
+SCORE_PLUGIN_ENGINE_EXPORT
+std::vector<int> parseCoreList(const QString& str);
+
+//! Returns false if the thread could not be pinned, e.g. for an invalid core
+SCORE_PLUGIN_ENGINE_EXPORT
+bool pinCurrentThread(const std::vector<int>& cores);
+
+//! Same as above for a single core, without allocating
+SCORE_PLUGIN_ENGINE_EXPORT
+bool pinCurrentThread(int core) noexcept;
+
+//! Requires the rtprio privilege on Linux
+SCORE_PLUGIN_ENGINE_EXPORT
+bool setCurrentThreadRealtime(bool realtime);
+
+//! Sleeps until shortly before the deadline then spins until it is reached
+SCORE_PLUGIN_ENGINE_EXPORT
+void waitUntil(
+    std::chrono::steady_clock::time_point deadline, std::chrono::microseconds spin);
+
+//! Pins the current thread on the first selected core, for the audio tick.
+//! Does not allocate, so that it can be called from the audio thread.
+SCORE_PLUGIN_ENGINE_EXPORT
+void configureTickThread(const ThreadConfiguration& conf);
+
+/**
+ * @brief Affinity and scheduling policy of a thread, to restore them later
+ *
+ * Only what applying a configuration would change is saved.
+ */
+class SCORE_PLUGIN_ENGINE_EXPORT SavedThreadState
+{
+public:
+  SavedThreadState();
+
+  //! Does not allocate, so that it can be called from the audio thread
+  void save(const ThreadConfiguration& conf) noexcept;
+  void restore() noexcept;
+
+private:
+  std::vector<int> m_cores;
+  int m_policy{-1};
+  int m_priority{};
+};
+
+/**
+ * @brief Runs a function in a new thread placed on the cores of the workers
+ *
+ * Threads started by the function inherit the affinity and scheduling policy
+ * of that thread: this is used to place the workers of the parallel graph,
+ * which are created by libossia, without changing the calling thread.
+ * Returns once the function has returned.
+ */
+SCORE_PLUGIN_ENGINE_EXPORT
+void runInWorkerConfiguration(const ThreadConfiguration& conf, std::function<void()> f);
+
+struct ConfiguredTicks
+{
+  tick_fun play;
+  tick_fun pause;
+};
+
+/**
+ * @brief Applies the configuration to the thread calling the ticks
+ *
+ * The audio thread is only known once the driver calls the play tick:
+ * it is configured on the first call, and the pause tick, installed when the
+ * execution is paused or stopped, gives it back its previous affinity and
+ * scheduling policy.
+ */
+SCORE_PLUGIN_ENGINE_EXPORT
+ConfiguredTicks makeConfiguredTicks(tick_fun play, tick_fun pause, ThreadConfiguration conf);
+}
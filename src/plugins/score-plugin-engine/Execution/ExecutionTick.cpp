@@ -28,7 +28,8 @@ struct AudioTickHelper
 #endif
   AudioTickHelper(
       ossia::tick_setup_options opt, Execution::DocumentPlugin& plug,
-      const std::shared_ptr<Execution::BaseScenarioElement>& scenar)
+      const std::shared_ptr<Execution::BaseScenarioElement>& scenar,
+      bool applicationActions)
       : m_scenar{scenar}
       , m_context{plug.contextData()}
       , m_itv{*scenar->baseInterval().OSSIAInterval()}
@@ -39,6 +40,9 @@ struct AudioTickHelper
         opt, *m_context->execState, *m_context->execGraph, m_itv, scenar->baseScenario(),
         plug.executionController().transport().transportUpdateFunction());
 
+    if(!applicationActions)
+      return;
+
     for(Execution::ExecutionAction& act :
         plug.context().doc.app.interfaces<Execution::ExecutionActionList>())
     {
@@ -183,9 +187,11 @@ struct AudioTickHelper
 
 Audio::tick_fun makeExecutionTick(
     ossia::tick_setup_options opt, Execution::DocumentPlugin& plug,
-    const std::shared_ptr<Execution::BaseScenarioElement>& scenar)
+    const std::shared_ptr<Execution::BaseScenarioElement>& scenar,
+    bool applicationActions)
 {
-  return [helper = std::make_shared<AudioTickHelper>(opt, plug, scenar)](
+  return [helper = std::make_shared<AudioTickHelper>(
+              opt, plug, scenar, applicationActions)](
              const ossia::audio_tick_state& t) {
     Audio::execution_status.store(ossia::transport_status::playing);
 
@@ -201,7 +207,7 @@ Audio::tick_fun makeBenchmarkTick(
 {
   int i = 0;
   QPointer<Execution::DocumentPlugin> plugPtr = &plug;
-  return [helper = std::make_shared<AudioTickHelper>(opt, plug, scenar), plugPtr,
+  return [helper = std::make_shared<AudioTickHelper>(opt, plug, scenar, true), plugPtr,
           i](const ossia::audio_tick_state& t) mutable {
     Audio::execution_status.store(ossia::transport_status::playing);
 
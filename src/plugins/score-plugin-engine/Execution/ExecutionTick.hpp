@@ -12,9 +12,12 @@ namespace Execution
 {
 using tick_fun = ossia::audio_engine::fun_type;
 
+//! The execution actions of the application assume that they are ticked by
+//! the audio engine: clocks ticking from another thread leave them out.
 tick_fun makeExecutionTick(
     ossia::tick_setup_options opt, Execution::DocumentPlugin& plug,
-    const std::shared_ptr<Execution::BaseScenarioElement>& scenar);
+    const std::shared_ptr<Execution::BaseScenarioElement>& scenar,
+    bool applicationActions = true);
 
 tick_fun makeBenchmarkTick(
     ossia::tick_setup_options opt, Execution::DocumentPlugin& plug,
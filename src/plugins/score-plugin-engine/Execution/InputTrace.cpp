@@ -0,0 +1,371 @@
+#include "InputTrace.hpp"
+
+#include <State/Address.hpp>
+#include <State/ValueSerialization.hpp>
+
+#include <Device/Protocol/DeviceInterface.hpp>
+
+#include <Explorer/DocumentPlugin/DeviceDocumentPlugin.hpp>
+
+#include <score/serialization/DataStreamVisitor.hpp>
+
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/node.hpp>
+#include <ossia/detail/small_vector.hpp>
+#include <ossia/network/base/parameter.hpp>
+
+#include <QDebug>
+
+#include <algorithm>
+
+namespace Execution
+{
+namespace
+{
+// "SCTR"
+static constexpr quint32 trace_magic = 0x53435452;
+static constexpr qint32 trace_version = 1;
+
+// Events kept between two writes, which happen every 100ms
+static constexpr std::size_t trace_capacity = 16384;
+
+enum TraceRecord : quint8
+{
+  TickRecord,
+  ValueRecord
+};
+
+template <typename F>
+void forEachParameter(ossia::net::node_base& node, const F& f)
+{
+  if(auto p = node.get_parameter())
+    f(*p);
+  for(auto& child : node.children())
+    forEachParameter(*child, f);
+}
+}
+
+InputTraceRecorder::InputTraceRecorder(
+    const Explorer::DeviceDocumentPlugin& devices, const QString& path, int rate)
+    : m_file{path}
+    , m_rate{double(rate)}
+    , m_trace{trace_capacity}
+{
+  if(!m_file.open(QIODevice::WriteOnly))
+  {
+    qDebug() << "Input trace: cannot open" << path;
+    m_finished = true;
+    return;
+  }
+  m_writer = std::make_unique<DataStreamReader>(&m_file);
+
+  // The addresses are written once in the header,
+  // values then only refer to their index
+  QStringList addresses;
+  for(Device::DeviceInterface* dev : devices.list().devices())
+  {
+    auto d = dev->getDevice();
+    if(!d)
+      continue;
+
+    const auto& name = dev->name();
+    forEachParameter(d->get_root_node(), [&](ossia::net::parameter_base& p) {
+      const int32_t idx = addresses.size();
+      addresses.push_back(name + ":" + QString::fromStdString(p.get_node().osc_address()));
+
+      m_callbacks[&p] = p.add_callback([this, idx](const ossia::value& v) {
+        m_received.enqueue(ReceivedValue{idx, v, clock::now()});
+      });
+      p.get_node().about_to_be_deleted.connect<&InputTraceRecorder::on_nodeRemoving>(
+          *this);
+    });
+  }
+
+  auto& s = m_writer->stream();
+  s << trace_magic << trace_version << qint32(rate) << addresses;
+
+  QObject::connect(&m_writeTimer, &QTimer::timeout, [this] { write(); });
+  m_writeTimer.start(100);
+}
+
+InputTraceRecorder::~InputTraceRecorder()
+{
+  finish();
+}
+
+void InputTraceRecorder::on_nodeRemoving(const ossia::net::node_base& n)
+{
+  if(auto p = n.get_parameter())
+    m_callbacks.erase(p);
+}
+
+void InputTraceRecorder::startTick(const ossia::audio_tick_state& t)
+{
+  if(m_finished)
+    return;
+
+  const auto now = clock::now();
+
+  // Values received since the previous tick are the ones
+  // the execution will see during this tick
+  ReceivedValue v;
+  while(m_received.try_dequeue(v))
+  {
+    const double elapsed = std::chrono::duration<double>(v.time - m_lastTick).count();
+    const uint64_t offset = elapsed <= 0. ? 0 : uint64_t(elapsed * m_rate);
+
+    if(!m_trace.try_enqueue(TraceEvent{v.address, std::move(v.value), offset}))
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if(!m_trace.try_enqueue(
+         TraceEvent{-1, {}, t.frames, t.seconds, t.position_in_frames, t.status}))
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+  m_lastTick = now;
+}
+
+void InputTraceRecorder::write()
+{
+  if(!m_writer)
+    return;
+
+  auto& s = m_writer->stream();
+  TraceEvent e;
+  while(m_trace.try_dequeue(e))
+  {
+    if(e.address == -1)
+    {
+      s << quint8(TickRecord) << quint64(e.frames) << e.seconds
+        << bool(e.position) << quint64(e.position.value_or(0))
+        << qint8(e.status ? int(*e.status) : -1);
+    }
+    else
+    {
+      s << quint8(ValueRecord) << e.address << quint64(e.frames) << e.value;
+    }
+  }
+
+  if(auto dropped = m_dropped.exchange(0, std::memory_order_relaxed))
+    qDebug() << "Input trace: the buffer was full," << dropped
+             << "events were not recorded";
+}
+
+void InputTraceRecorder::finish()
+{
+  if(m_finished.exchange(true))
+    return;
+
+  m_writeTimer.stop();
+  for(auto& [param, cb] : m_callbacks)
+  {
+    param->remove_callback(cb);
+    param->get_node().about_to_be_deleted.disconnect<&InputTraceRecorder::on_nodeRemoving>(
+        *this);
+  }
+  m_callbacks.clear();
+
+  write();
+  m_writer.reset();
+  m_file.close();
+}
+
+bool InputTracePlayer::load(
+    const Explorer::DeviceDocumentPlugin& devices, const QString& path, int rate,
+    int bufferSize)
+{
+  QFile f{path};
+  if(!f.open(QIODevice::ReadOnly))
+  {
+    qDebug() << "Input trace: cannot open" << path;
+    return false;
+  }
+
+  DataStreamWriter reader{&f};
+  auto& s = reader.stream();
+
+  quint32 magic{};
+  qint32 version{}, trace_rate{};
+  QStringList addresses;
+  s >> magic >> version >> trace_rate >> addresses;
+  if(magic != trace_magic || version != trace_version)
+  {
+    qDebug() << "Input trace: invalid file" << path;
+    return false;
+  }
+
+  // The offsets of the values are counted in frames
+  if(rate != trace_rate)
+  {
+    qDebug() << "Input trace: recorded at" << trace_rate << "Hz, the engine runs at"
+             << rate << "Hz";
+    return false;
+  }
+  m_rate = rate;
+
+  std::vector<ossia::net::parameter_base*> parameters;
+  parameters.reserve(addresses.size());
+  for(const QString& str : addresses)
+  {
+    ossia::net::parameter_base* param{};
+    if(auto addr = State::Address::fromString(str))
+    {
+      if(auto dev = devices.list().findDevice(addr->device))
+        if(auto d = dev->getDevice())
+          if(auto node = Device::findNodeFromPath(addr->path, *d))
+            param = node->get_parameter();
+    }
+
+    if(!param)
+      qDebug() << "Input trace: address not found, its values will be ignored:" << str;
+    parameters.push_back(param);
+  }
+
+  m_ticks.clear();
+  m_current = 0;
+
+  Tick cur;
+  while(!f.atEnd() && s.stream.status() == QDataStream::Ok)
+  {
+    quint8 kind{};
+    s >> kind;
+    if(kind == TickRecord)
+    {
+      quint64 frames{}, position{};
+      bool has_position{};
+      qint8 status{};
+      s >> frames >> cur.seconds >> has_position >> position >> status;
+      // Replaying a tick larger than the buffers of the engine would
+      // write past them: truncating it would shift all the following ones
+      if(frames > quint64(bufferSize))
+      {
+        qDebug() << "Input trace: recorded with buffers of" << frames
+                 << "frames, the engine uses" << bufferSize;
+        m_ticks.clear();
+        return false;
+      }
+
+      cur.frames = frames;
+      if(has_position)
+        cur.position = position;
+      if(status >= 0)
+        cur.status = ossia::transport_status(status);
+
+      // Values arriving later than the length of the tick
+      // are applied at its last frame
+      for(auto& v : cur.values)
+        v.offset = std::min(v.offset, frames > 0 ? frames - 1 : 0);
+      std::stable_sort(
+          cur.values.begin(), cur.values.end(),
+          [](const Value& lhs, const Value& rhs) { return lhs.offset < rhs.offset; });
+
+      m_ticks.push_back(std::move(cur));
+      cur = {};
+    }
+    else
+    {
+      qint32 idx{};
+      quint64 offset{};
+      ossia::value v;
+      s >> idx >> offset >> v;
+      if(idx >= 0 && idx < std::ssize(parameters) && parameters[idx])
+        cur.values.push_back({parameters[idx], offset, std::move(v)});
+    }
+  }
+
+  qDebug() << "Input trace: loaded" << m_ticks.size() << "ticks from" << path;
+  return true;
+}
+
+void InputTracePlayer::tick(const ossia::audio_tick_state& t, const tick_fun& f)
+{
+  if(m_current >= m_ticks.size())
+  {
+    f(t);
+    return;
+  }
+
+  auto& cur = m_ticks[m_current++];
+  if(cur.frames > t.frames)
+  {
+    // The engine was reconfigured since the trace was loaded,
+    // this is reported from the GUI thread in finish()
+    m_interrupted = true;
+    m_current = m_ticks.size();
+    f(t);
+    return;
+  }
+
+  ossia::audio_tick_state st = t;
+  st.frames = cur.frames;
+  st.seconds = cur.seconds;
+  st.position_in_frames = cur.position;
+  st.status = cur.status;
+
+  auto it = cur.values.begin();
+  auto apply_until = [&](uint64_t offset) {
+    for(; it != cur.values.end() && it->offset <= offset; ++it)
+      it->parameter->set_value(std::move(it->value));
+  };
+
+  if(cur.values.empty() || cur.frames == 0)
+  {
+    apply_until(cur.frames);
+    f(st);
+    return;
+  }
+
+  // The tick is split at the offsets of the values,
+  // so that each of them is seen by the execution at its frame
+  using input_ptr = std::remove_cvref_t<decltype(t.inputs[0])>;
+  using output_ptr = std::remove_cvref_t<decltype(t.outputs[0])>;
+  ossia::small_vector<input_ptr, 32> inputs(t.n_in);
+  ossia::small_vector<output_ptr, 32> outputs(t.n_out);
+
+  uint64_t start = 0;
+  while(start < cur.frames)
+  {
+    apply_until(start);
+    const uint64_t end = it == cur.values.end() ? cur.frames : it->offset;
+
+    ossia::audio_tick_state sub = st;
+    for(int i = 0; i < t.n_in; i++)
+      inputs[i] = t.inputs[i] + start;
+    for(int i = 0; i < t.n_out; i++)
+      outputs[i] = t.outputs[i] + start;
+    sub.inputs = inputs.data();
+    sub.outputs = outputs.data();
+    sub.frames = end - start;
+    sub.seconds = st.seconds + double(start) / m_rate;
+    if(st.position_in_frames)
+      sub.position_in_frames = *st.position_in_frames + start;
+
+    f(sub);
+    start = end;
+  }
+}
+
+void InputTracePlayer::finish()
+{
+  if(m_interrupted.exchange(false))
+    qDebug() << "Input trace: the buffer size changed, the replay was stopped";
+}
+
+tick_fun makeRecordingTick(tick_fun tick, std::shared_ptr<InputTraceRecorder> rec)
+{
+  // The inner tick is shared so that the wrapper stays small enough
+  // for the audio engine's function storage
+  return [tick = std::make_shared<tick_fun>(std::move(tick)),
+          rec = std::move(rec)](const ossia::audio_tick_state& t) {
+    rec->startTick(t);
+    (*tick)(t);
+  };
+}
+
+tick_fun makeReplayTick(tick_fun tick, std::shared_ptr<InputTracePlayer> player)
+{
+  return [tick = std::make_shared<tick_fun>(std::move(tick)),
+          player = std::move(player)](const ossia::audio_tick_state& t) {
+    player->tick(t, *tick);
+  };
+}
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include <Execution/ExecutionTick.hpp>
+
+#include <ossia/detail/callback_container.hpp>
+#include <ossia/detail/hash_map.hpp>
+#include <ossia/network/value/value.hpp>
+
+#include <QFile>
+#include <QTimer>
+
+#include <concurrentqueue.h>
+#include <readerwriterqueue.h>
+
+#include <chrono>
+#include <optional>
+
+class DataStreamReader;
+namespace ossia::net
+{
+class node_base;
+class parameter_base;
+}
+namespace Explorer
+{
+class DeviceDocumentPlugin;
+}
+namespace Execution
+{
+/**
+ * @brief Records the input of an execution in a binary trace
+ *
+ * Every value received by the devices of the document is timestamped on
+ * the device thread, and assigned at the start of the next tick along with
+ * its offset in frames in the buffer during which it arrived.
+ * The transport state of every tick is recorded too.
+ * Events are stored in a ring buffer allocated up-front, emptied on the GUI
+ * thread: if it fills up the events are dropped, and reported when writing.
+ *
+ * Enabled by setting SCORE_INPUT_TRACE_RECORD to the path of the trace.
+ */
+class InputTraceRecorder
+{
+public:
+  InputTraceRecorder(
+      const Explorer::DeviceDocumentPlugin& devices, const QString& path, int rate);
+  ~InputTraceRecorder();
+
+  //! Audio thread
+  void startTick(const ossia::audio_tick_state& t);
+
+  //! GUI thread: stops listening to the devices and writes what is left
+  void finish();
+
+private:
+  using clock = std::chrono::steady_clock;
+  struct ReceivedValue
+  {
+    int32_t address{};
+    ossia::value value;
+    clock::time_point time;
+  };
+
+  struct TraceEvent
+  {
+    int32_t address{-1}; // -1 for a tick
+    ossia::value value;
+    uint64_t frames{}; // Offset for a value, buffer size for a tick
+    double seconds{};
+    std::optional<uint64_t> position;
+    std::optional<ossia::transport_status> status;
+  };
+
+  void on_nodeRemoving(const ossia::net::node_base& n);
+  void write();
+
+  QFile m_file;
+  std::unique_ptr<DataStreamReader> m_writer;
+  QTimer m_writeTimer;
+  double m_rate{};
+
+  ossia::hash_map<
+      ossia::net::parameter_base*,
+      ossia::callback_container<ossia::value_callback>::iterator>
+      m_callbacks;
+
+  moodycamel::ConcurrentQueue<ReceivedValue> m_received;
+  moodycamel::ReaderWriterQueue<TraceEvent> m_trace;
+  std::atomic<uint64_t> m_dropped{};
+  clock::time_point m_lastTick{clock::now()};
+  std::atomic_bool m_finished{};
+};
+
+/**
+ * @brief Feeds a trace recorded by InputTraceRecorder back to an execution
+ *
+ * The values received during each recorded tick are applied to their
+ * parameters as if they came from the network, at their recorded offset in
+ * the buffer: the tick is split at these offsets. The ticks run with the
+ * recorded buffer size and transport state.
+ * Best used with the dummy audio engine so that the replay does not depend
+ * on the sound card.
+ *
+ * Enabled by setting SCORE_INPUT_TRACE_REPLAY to the path of the trace.
+ */
+class InputTracePlayer
+{
+public:
+  //! Resolves the recorded addresses in the current devices.
+  //! The trace is rejected if it was recorded at another rate, or with
+  //! buffers larger than the ones of the engine.
+  bool load(
+      const Explorer::DeviceDocumentPlugin& devices, const QString& path, int rate,
+      int bufferSize);
+
+  //! Audio thread
+  void tick(const ossia::audio_tick_state& t, const tick_fun& f);
+
+  //! GUI thread: reports if the replay had to be interrupted
+  void finish();
+
+private:
+  struct Value
+  {
+    ossia::net::parameter_base* parameter{};
+    uint64_t offset{};
+    ossia::value value;
+  };
+
+  struct Tick
+  {
+    std::vector<Value> values;
+    uint64_t frames{};
+    double seconds{};
+    std::optional<uint64_t> position;
+    std::optional<ossia::transport_status> status;
+  };
+
+  std::vector<Tick> m_ticks;
+  std::size_t m_current{};
+  double m_rate{};
+  std::atomic_bool m_interrupted{};
+};
+
+tick_fun makeRecordingTick(tick_fun tick, std::shared_ptr<InputTraceRecorder> rec);
+tick_fun makeReplayTick(tick_fun tick, std::shared_ptr<InputTracePlayer> player);
+}
@@ -36,6 +36,9 @@ SETTINGS_PARAMETER_IMPL(Commit){
 SETTINGS_PARAMETER_IMPL(Tick){
     QStringLiteral("score_plugin_engine/Tick"), TickPolicies{}.Buffer};
 SETTINGS_PARAMETER_IMPL(Parallel){QStringLiteral("score_plugin_engine/Parallel"), false};
+SETTINGS_PARAMETER_IMPL(Affinity){QStringLiteral("score_plugin_engine/Affinity"), ""};
+SETTINGS_PARAMETER_IMPL(Realtime){QStringLiteral("score_plugin_engine/Realtime"), false};
+SETTINGS_PARAMETER_IMPL(Spin){QStringLiteral("score_plugin_engine/Spin"), 0};
 SETTINGS_PARAMETER_IMPL(ExecutionListening){
     QStringLiteral("score_plugin_engine/ExecListening"), true};
 SETTINGS_PARAMETER_IMPL(Logging){QStringLiteral("score_plugin_engine/Logging"), false};
@@ -51,7 +54,7 @@ static auto list()
 {
   return std::tie(
       Clock, Rate, Threads, Scheduling, Ordering, Merging, Commit, Tick, Parallel,
-      ExecutionListening, Logging, Bench, ScoreOrder, ValueCompilation,
+      Affinity, Realtime, Spin, ExecutionListening, Logging, Bench, ScoreOrder, ValueCompilation,
       TransportValueCompilation);
 }
 }
@@ -111,6 +114,9 @@ SCORE_SETTINGS_PARAMETER_CPP(QString, Model, Tick)
 SCORE_SETTINGS_PARAMETER_CPP(int, Model, Rate)
 SCORE_SETTINGS_PARAMETER_CPP(int, Model, Threads)
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, Parallel)
+SCORE_SETTINGS_PARAMETER_CPP(QString, Model, Affinity)
+SCORE_SETTINGS_PARAMETER_CPP(bool, Model, Realtime)
+SCORE_SETTINGS_PARAMETER_CPP(int, Model, Spin)
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, ExecutionListening)
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, Logging)
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, Bench)
@@ -73,6 +73,9 @@ class SCORE_PLUGIN_ENGINE_EXPORT Model : public score::SettingsDelegateModel
   int m_Rate{};
   int m_Threads{};
   bool m_Parallel{};
+  QString m_Affinity;
+  bool m_Realtime{};
+  int m_Spin{};
   bool m_ExecutionListening{};
   bool m_Logging{};
   bool m_Bench{};
@@ -104,6 +107,9 @@ public:
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, int, Rate)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, int, Threads)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, bool, Parallel)
+  SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, QString, Affinity)
+  SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, bool, Realtime)
+  SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, int, Spin)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, bool, ExecutionListening)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, bool, Logging)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_ENGINE_EXPORT, bool, Bench)
@@ -122,6 +128,9 @@ SCORE_SETTINGS_PARAMETER(Model, Tick)
 SCORE_SETTINGS_PARAMETER(Model, Rate)
 SCORE_SETTINGS_PARAMETER(Model, Threads)
 SCORE_SETTINGS_PARAMETER(Model, Parallel)
+SCORE_SETTINGS_PARAMETER(Model, Affinity)
+SCORE_SETTINGS_PARAMETER(Model, Realtime)
+SCORE_SETTINGS_PARAMETER(Model, Spin)
 SCORE_SETTINGS_PARAMETER(Model, ExecutionListening)
 SCORE_SETTINGS_PARAMETER(Model, Logging)
 SCORE_SETTINGS_PARAMETER(Model, Bench)
@@ -32,6 +32,9 @@ Presenter::Presenter(Model& m, View& v, QObject* parent)
   //SETTINGS_PRESENTER(Tick);
   SETTINGS_PRESENTER(Parallel);
   SETTINGS_PRESENTER(Threads);
+  SETTINGS_PRESENTER(Affinity);
+  SETTINGS_PRESENTER(Realtime);
+  SETTINGS_PRESENTER(Spin);
   SETTINGS_PRESENTER(Logging);
   SETTINGS_PRESENTER(Bench);
   SETTINGS_PRESENTER(ExecutionListening);
@@ -8,6 +8,7 @@
 #include <QCheckBox>
 #include <QFormLayout>
 #include <QGroupBox>
+#include <QLineEdit>
 
 namespace Execution
 {
@@ -63,6 +64,24 @@ View::View()
     m_Threads->setEnabled(m_Parallel->isChecked());
   });
 
+  m_Affinity = new QLineEdit{m_widg};
+  m_Affinity->setPlaceholderText(tr("e.g. 2-9 or node:1"));
+  m_Affinity->setToolTip(
+      tr("Cores on which the execution runs: the audio tick uses the first one and "
+         "the parallel workers the others.\n"
+         "node:N selects all the cores of the NUMA node N."));
+  lay->addRow(tr("Cores"), m_Affinity);
+  connect(m_Affinity, &QLineEdit::editingFinished, this, [this] {
+    AffinityChanged(m_Affinity->text());
+  });
+
+  SETTINGS_UI_TOGGLE_SETUP(
+      "Realtime priority\nRun the execution threads with the SCHED_FIFO policy. "
+      "This requires the rtprio privilege on Linux.",
+      Realtime);
+  SETTINGS_UI_SPINBOX_SETUP("Spin before deadline (us)", Spin);
+  m_Spin->setRange(0, 5000);
+
   // SETTINGS_UI_TOGGLE_SETUP("Use Score order", ScoreOrder);
 
   SETTINGS_UI_TOGGLE_SETUP(
@@ -84,10 +103,18 @@ SETTINGS_UI_COMBOBOX_IMPL(Merging)
 SETTINGS_UI_COMBOBOX_IMPL(Commit)
 
 SETTINGS_UI_SPINBOX_IMPL(Threads)
+SETTINGS_UI_SPINBOX_IMPL(Spin)
+
+void View::setAffinity(QString val)
+{
+  if(val != m_Affinity->text())
+    m_Affinity->setText(val);
+}
 
 SETTINGS_UI_TOGGLE_IMPL(ExecutionListening)
 SETTINGS_UI_TOGGLE_IMPL(ScoreOrder)
 SETTINGS_UI_TOGGLE_IMPL(Parallel)
+SETTINGS_UI_TOGGLE_IMPL(Realtime)
 SETTINGS_UI_TOGGLE_IMPL(Logging)
 SETTINGS_UI_TOGGLE_IMPL(Bench)
 SETTINGS_UI_TOGGLE_IMPL(ValueCompilation)
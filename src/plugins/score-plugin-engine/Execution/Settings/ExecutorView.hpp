@@ -5,6 +5,7 @@
 
 #include <verdigris>
 
+class QLineEdit;
 namespace score
 {
 class FormWidget;
@@ -30,14 +31,21 @@ public:
   SETTINGS_UI_TOGGLE_HPP(Bench)
   SETTINGS_UI_TOGGLE_HPP(Parallel)
   SETTINGS_UI_SPINBOX_HPP(Threads)
+  SETTINGS_UI_TOGGLE_HPP(Realtime)
+  SETTINGS_UI_SPINBOX_HPP(Spin)
   SETTINGS_UI_TOGGLE_HPP(ExecutionListening)
   SETTINGS_UI_TOGGLE_HPP(ScoreOrder)
   SETTINGS_UI_TOGGLE_HPP(ValueCompilation)
   SETTINGS_UI_TOGGLE_HPP(TransportValueCompilation)
 
+public:
+  void setAffinity(QString);
+  void AffinityChanged(QString arg) W_SIGNAL(AffinityChanged, arg);
+
 private:
   QWidget* getWidget() override;
   score::FormWidget* m_widg{};
+  QLineEdit* m_Affinity{};
 };
 }
 }
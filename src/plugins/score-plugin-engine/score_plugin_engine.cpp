@@ -13,6 +13,7 @@
 #include <Execution/Clock/DataflowClock.hpp>
 #include <Execution/Clock/DefaultClock.hpp>
 #include <Execution/Clock/ManualClock.hpp>
+#include <Execution/Clock/OfflineClock.hpp>
 #include <Execution/DocumentPlugin.hpp>
 #include <Execution/Settings/ExecutorFactory.hpp>
 #include <Execution/Transport/JackTransport.hpp>
@@ -75,7 +76,8 @@ std::vector<score::InterfaceBase*> score_plugin_engine::factories(
       FW<Execution::ClockFactory
          // , Execution::ControlClockFactory
          ,
-         Dataflow::ClockFactory
+         Dataflow::ClockFactory,
+         Execution::OfflineClockFactory
          //, ManualClock::ClockFactory
          >>(ctx, key);
 }
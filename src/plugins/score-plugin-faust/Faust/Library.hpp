@@ -20,13 +20,6 @@ class LibraryHandler final
 
   QSet<QString> acceptedFiles() const noexcept override { return {"dsp"}; }
 
-  static inline const QRegularExpression nameExpr{
-      R"_(declare name "([a-zA-Z0-9_\-]+)";)_"};
-  static inline const QRegularExpression authorExpr{
-      R"_(declare author "([a-zA-Z0-9_\-]+)";)_"};
-  static inline const QRegularExpression descExpr{
-      R"_(declare description "([a-zA-Z0-9.<>\(\):/~, _\-]+)";)_"};
-
   Library::Subcategories categories;
 
   void setup(Library::ProcessesItemModel& model, const score::GUIApplicationContext& ctx)
@@ -43,13 +36,25 @@ class LibraryHandler final
 
   void addPath(std::string_view path) override
   {
-    score::PathInfo file{path};
-    if(file.fileName != "layout.dsp")
-      registerDSP(file);
+    addMetadata(path, readMetadata(path));
   }
 
-  void registerDSP(const score::PathInfo& file)
+  bool cachesMetadata() const noexcept override { return true; }
+
+  QByteArray readMetadata(std::string_view path) override
   {
+    score::PathInfo file{path};
+    if(file.fileName == "layout.dsp")
+      return {};
+
+    // Called from several worker threads at once: each has its own expressions
+    thread_local const QRegularExpression nameExpr{
+        R"_(declare name "([a-zA-Z0-9_\-]+)";)_"};
+    thread_local const QRegularExpression authorExpr{
+        R"_(declare author "([a-zA-Z0-9_\-]+)";)_"};
+    thread_local const QRegularExpression descExpr{
+        R"_(declare description "([a-zA-Z0-9.<>\(\):/~, _\-]+)";)_"};
+
     Library::ProcessData pdata;
     pdata.prettyName
         = QString::fromUtf8(file.completeBaseName.data(), file.completeBaseName.size());
@@ -80,7 +85,13 @@ class LibraryHandler final
       }
     }
 
-    categories.add(file, std::move(pdata));
+    return Library::toMetadata(pdata);
+  }
+
+  void addMetadata(std::string_view path, const QByteArray& metadata) override
+  {
+    if(auto pdata = Library::fromMetadata(metadata))
+      categories.add(score::PathInfo{path}, std::move(*pdata));
   }
 };
 
@@ -1,6 +1,9 @@
 #pragma once
+#include <Audio/Settings/Model.hpp>
 #include <Engine/Node/SimpleApi.hpp>
 
+#include <score/application/ApplicationContext.hpp>
+
 namespace Nodes::AudioLooper
 {
 struct Node
@@ -45,9 +48,34 @@ struct Node
     double sampleRate{48000.};
     bool isPostRecording{false};
 
-    static constexpr int64_t default_buffer_size = 192000 * 32;
+    // Maximum length of a loop, in samples, set in the audio settings.
+    // The buffers are reserved up-front to this size when the looper is
+    // created and recording stops growing them once it is reached,
+    // so that the audio thread never reallocates.
+    int64_t max_loop_samples{max_loop_length()};
+
+    static int64_t max_loop_length()
+    {
+      const auto& set = score::AppContext().settings<Audio::Settings::Model>();
+      return std::max(int64_t(1), int64_t(set.getLooperMaxLength())) * set.getRate();
+    }
+
     void reset_elapsed() { }
     int channels() const noexcept { return actualChannels; }
+
+    // How many samples can still be recorded starting from pos
+    int64_t available(int64_t pos) const noexcept
+    {
+      return std::max(int64_t(0), max_loop_samples - pos);
+    }
+
+    // Sizes a channel to hold the samples recorded in this tick, clamped to
+    // the preallocated capacity
+    void grow(ossia::audio_channel& chan, int64_t samples) const noexcept
+    {
+      chan.resize(std::min(playbackPos + samples, max_loop_samples));
+    }
+
     void set_channels(int chans)
     {
       const int64_t cur_channels = std::ssize(audio);
@@ -57,10 +85,9 @@ struct Node
         audio.resize(actualChannels);
 
         int64_t min_size = audio[0].size();
-        int64_t min_capa = std::max(int64_t(audio[0].capacity()), default_buffer_size);
         for(int i = cur_channels; i < actualChannels; i++)
         {
-          audio[i].reserve(min_capa);
+          audio[i].reserve(max_loop_samples);
           audio[i].resize(min_size);
         }
       }
@@ -77,7 +104,7 @@ struct Node
     {
       audio.resize(2);
       for(auto& vec : audio)
-        vec.reserve(default_buffer_size);
+        vec.reserve(max_loop_samples);
     }
   };
 
@@ -86,7 +113,8 @@ struct Node
     const double sr = state.sampleRate;
     const double bar_samples
         = sr * 4. * (double(tk.signature.upper) / tk.signature.lower) * (60. / tk.tempo);
-    const double total_samples = std::floor(state.postaction_bars * bar_samples);
+    const double total_samples = std::min(
+        std::floor(state.postaction_bars * bar_samples), double(state.max_loop_samples));
 
     // If there are more samples than expected we crop
     const bool quantify_length = (state.quantif > 0.f) && (state.channels() > 0);
@@ -510,15 +538,20 @@ struct Node
       int64_t max = std::min(N, samples);
 
       out.resize(samples);
-      record.resize(state.playbackPos + samples);
+      state.grow(record, samples);
+      const int64_t rec_max
+          = std::min(max, first_pos + state.available(state.playbackPos));
       int64_t k = state.playbackPos;
 
-      for(int64_t j = first_pos; j < max; j++)
+      for(int64_t j = first_pos; j < rec_max; j++)
       {
-        out[j] = in[j];
         record[k] = in[j];
         k++;
       }
+      for(int64_t j = first_pos; j < max; j++)
+      {
+        out[j] = in[j];
+      }
     }
     state.playbackPos += N;
   }
@@ -540,10 +573,12 @@ struct Node
       const int64_t samples = in.size();
       int64_t max = std::min(N, samples);
 
-      record.resize(state.playbackPos + samples);
+      state.grow(record, samples);
+      const int64_t rec_max
+          = std::min(max, first_pos + state.available(state.playbackPos));
       int64_t k = state.playbackPos;
 
-      for(int64_t j = first_pos; j < max; j++)
+      for(int64_t j = first_pos; j < rec_max; j++)
       {
         record[k] = in[j];
         k++;
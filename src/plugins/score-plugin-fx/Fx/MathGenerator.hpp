@@ -34,6 +34,32 @@ static void setMathExpressionTiming(
       self, tk.date, tk.prev_date, tk.parent_duration, st.modelToSamples());
 }
 
+/**
+ * @brief Compiles the ExprTK expression only when its text changed.
+ *
+ * Parsing and compiling an expression is far more expensive than evaluating
+ * it, and the LineEdit control sends the same string on every tick.
+ * The compiled expression is kept in the state until the text is edited
+ * or the symbol table is reset (see invalidateMathExpression).
+ */
+template <typename State>
+static bool updateMathExpression(State& self, const std::string& expr)
+{
+  if(expr != self.cur_expression)
+  {
+    self.cur_expression = expr;
+    self.ok = self.expr.set_expression(expr);
+  }
+  return self.ok;
+}
+
+template <typename State>
+static void invalidateMathExpression(State& self)
+{
+  self.cur_expression.clear();
+  self.ok = false;
+}
+
 static void miniMathItem(
     const tuplet::tuple<Control::LineEdit>& controls, Process::LineEdit& edit,
     const Process::ProcessModel& process, QGraphicsItem& parent, QObject& context,
@@ -146,6 +172,7 @@ struct Node
     double p1{}, p2{}, p3{};
     double m1{}, m2{}, m3{};
     ossia::math_expression expr;
+    std::string cur_expression;
     bool ok = false;
   };
 
@@ -154,7 +181,7 @@ struct Node
   run(const std::string& expr, float a, float b, float c, ossia::value_port& output,
       ossia::token_request tk, ossia::exec_state_facade st, State& self)
   {
-    if(!self.expr.set_expression(expr))
+    if(!updateMathExpression(self, expr))
       return;
 
     setMathExpressionTiming(self, tk, st);
@@ -242,6 +269,7 @@ struct Node
       if(N == cur_out.size())
         return;
 
+      invalidateMathExpression(*this);
       expr.remove_vector("out");
       expr.remove_vector("m1");
       expr.remove_vector("m2");
@@ -265,6 +293,7 @@ struct Node
     std::vector<double> m1, m2, m3;
     double fs{44100};
     ossia::math_expression expr;
+    std::string cur_expression;
     bool ok = false;
   };
 
@@ -276,25 +305,29 @@ struct Node
     if(tk.forward())
     {
       self.fs = st.sampleRate();
-      if(!self.expr.set_expression(expr))
+
+      const int chans = 2;
+      self.reset_symbols(chans);
+      if(!updateMathExpression(self, expr))
         return;
 
       const auto samplesRatio = st.modelToSamples();
       const auto [tick_start, count] = st.timings(tk);
 
-      const int chans = 2;
-      self.reset_symbols(chans);
       output.set_channels(chans);
+      double* outs[2];
       for(int j = 0; j < chans; j++)
       {
         auto& out = output.channel(j);
         out.resize(st.bufferSize(), boost::container::default_init);
+        outs[j] = out.data() + tick_start;
       }
 
       self.p1 = a;
       self.p2 = b;
       self.p3 = c;
       const auto start_sample = (tk.prev_date * samplesRatio).impl;
+      const double* cur_out = self.cur_out.data();
       for(int64_t i = 0; i < count; i++)
       {
         self.cur_time = start_sample + i;
@@ -304,9 +337,7 @@ struct Node
 
         // Apply the output
         for(int j = 0; j < chans; j++)
-        {
-          output.channel(j)[tick_start + i] = self.cur_out[j];
-        }
+          outs[j][i] = cur_out[j];
       }
     }
   }
@@ -306,6 +306,7 @@ struct Node
     double m1{}, m2{}, m3{};
 
     ossia::math_expression expr;
+    std::string cur_expression;
     int64_t last_value_time{};
 
     bool ok = false;
@@ -317,7 +318,7 @@ struct Node
       ossia::value_port& output, ossia::token_request tk, ossia::exec_state_facade st,
       State& self)
   {
-    if(!self.expr.set_expression(expr))
+    if(!updateMathExpression(self, expr))
       return;
 
     self.a = a;
@@ -419,6 +420,7 @@ struct Node
       if(N == cur_in.size())
         return;
 
+      invalidateMathExpression(*this);
       expr.remove_vector("x");
       expr.remove_vector("out");
       expr.remove_vector("px");
@@ -451,6 +453,7 @@ struct Node
     std::vector<double> m1, m2, m3;
     double fs{44100};
     ossia::math_expression expr;
+    std::string cur_expression;
     bool ok = false;
   };
 
@@ -463,26 +466,31 @@ struct Node
     if(tk.date > tk.prev_date)
     {
       self.fs = st.sampleRate();
-      if(!self.expr.set_expression(expr))
+      if(input.empty())
+        return;
+
+      const int chans = input.channels();
+      self.reset_symbols(chans);
+      if(!updateMathExpression(self, expr))
         return;
 
       const auto samplesRatio = st.modelToSamples();
       const auto [tick_start, count] = st.timings(tk);
 
-      if(input.empty())
-        return;
-
       const auto min_count
           = std::min((int64_t)input.channel(0).size() - tick_start, count);
 
-      const int chans = input.channels();
-      self.reset_symbols(chans);
       output.set_channels(chans);
 
+      // Resolve the channel pointers once per block instead of per sample
+      auto ins = (const double**)alloca(sizeof(double*) * chans);
+      auto outs = (double**)alloca(sizeof(double*) * chans);
       for(int j = 0; j < chans; j++)
       {
         auto& out = output.channel(j);
         out.resize(st.bufferSize(), boost::container::default_init);
+        outs[j] = out.data() + tick_start;
+        ins[j] = input.channel(j).data() + tick_start;
       }
 
       self.p1 = a;
@@ -492,9 +500,7 @@ struct Node
       for(int64_t i = 0; i < min_count; i++)
       {
         for(int j = 0; j < chans; j++)
-        {
-          self.cur_in[j] = input.channel(j)[tick_start + i];
-        }
+          self.cur_in[j] = ins[j][i];
         self.cur_time = start_sample + i;
 
         // Compute the value
@@ -502,10 +508,11 @@ struct Node
 
         // Apply the output
         for(int j = 0; j < chans; j++)
-        {
-          output.channel(j)[tick_start + i] = self.cur_out[j];
-        }
-        std::swap(self.cur_in, self.prev_in);
+          outs[j][i] = self.cur_out[j];
+
+        // Copy rather than swap: the symbol table holds references
+        // to the storage of both vectors.
+        std::copy_n(self.cur_in.data(), chans, self.prev_in.data());
       }
     }
   }
@@ -576,9 +583,10 @@ struct Node
     double cur_pos{};
 
     ossia::math_expression expr;
+    std::string cur_expression;
     int64_t last_value_time{};
 
-    //bool ok = false;
+    bool ok = false;
   };
 
   using control_policy = ossia::safe_nodes::last_tick;
@@ -587,7 +595,7 @@ struct Node
   run(const ossia::value_port& input, const std::string& expr, ossia::value_port& output,
       const ossia::token_request& tk, ossia::exec_state_facade st, State& self)
   {
-    if(!self.expr.set_expression(expr))
+    if(!updateMathExpression(self, expr))
       return;
 
     if(self.expr.has_variable("xv"))
@@ -31,6 +31,16 @@ void LibraryHandler::setup(
 }
 
 void LibraryHandler::addPath(std::string_view path)
+{
+  addMetadata(path, readMetadata(path));
+}
+
+bool LibraryHandler::cachesMetadata() const noexcept
+{
+  return true;
+}
+
+QByteArray LibraryHandler::readMetadata(std::string_view path)
 {
   score::PathInfo file{path};
 
@@ -41,7 +51,13 @@ void LibraryHandler::addPath(std::string_view path)
   pdata.key = Metadata<ConcreteKey_k, Filter::Model>::get();
   pdata.author = "ISF";
   pdata.customData = QString::fromUtf8(path.data(), path.size());
-  categories.add(file, std::move(pdata));
+  return Library::toMetadata(pdata);
+}
+
+void LibraryHandler::addMetadata(std::string_view path, const QByteArray& metadata)
+{
+  if(auto pdata = Library::fromMetadata(metadata))
+    categories.add(score::PathInfo{path}, std::move(*pdata));
 }
 
 QWidget*
@@ -16,6 +16,9 @@ class LibraryHandler final : public Library::LibraryInterface
       override;
 
   void addPath(std::string_view path) override;
+  bool cachesMetadata() const noexcept override;
+  QByteArray readMetadata(std::string_view path) override;
+  void addMetadata(std::string_view path, const QByteArray& metadata) override;
   QWidget* previewWidget(const QString& path, QWidget* parent) const noexcept override;
   QWidget*
   previewWidget(const Process::Preset& path, QWidget* parent) const noexcept override;
@@ -8,9 +8,11 @@
 #include <score/document/DocumentContext.hpp>
 #include <score/tools/Bind.hpp>
 
+#include <ossia/detail/algorithms.hpp>
 #include <ossia/detail/flicks.hpp>
 #include <ossia/detail/logger.hpp>
 
+#include <QDebug>
 #include <QGuiApplication>
 #include <QTimer>
 namespace Gfx
@@ -151,6 +153,7 @@ void GfxContext::recompute_graph()
   for(auto [id, ptr] : m_manualTimers)
     killTimer(id);
   m_manualTimers.clear();
+  m_offlineOutputs.clear();
 
   m_timer = -1;
   m_graph->setVSyncCallback({});
@@ -193,10 +196,23 @@ void GfxContext::recompute_graph()
   {
     if(auto conf = outputs->output.configuration(); conf.manualRenderingRate)
     {
-      int id = startTimer(*conf.manualRenderingRate, Qt::PreciseTimer);
-      m_manualTimers[id] = &outputs->output;
+      if(conf.offline)
+      {
+        m_offlineOutputs.push_back(
+            {&outputs->output, *conf.manualRenderingRate / 1000., -1.});
+
+        // The graph can change while exporting
+        if(m_offline)
+          outputs->output.startOfflineRendering();
+      }
+      else
+      {
+        int id = startTimer(*conf.manualRenderingRate, Qt::PreciseTimer);
+        m_manualTimers[id] = &outputs->output;
+      }
     }
   }
+  update_offline_period();
 }
 
 void GfxContext::add_preview_output(score::gfx::OutputNode& node)
@@ -214,15 +230,26 @@ void GfxContext::add_preview_output(score::gfx::OutputNode& node)
     m_timer = startTimer(rate);
 }
 
-void GfxContext::recompute_connections()
+void GfxContext::recompute_connections(const ossia::flat_set<Edge>& previous_edges)
 {
-  recompute_graph();
-  // FIXME for more performance
-  /*
-  recompute_edges();
-  // m_graph->setupOutputs(m_api);
+  // Only apply the difference, so that the renderers
+  // of the nodes which are not concerned are kept as is
+  for(const auto& edge : previous_edges)
+    if(edges.find(edge) == edges.end())
+      remove_edge(edge);
+  for(const auto& edge : edges)
+    if(previous_edges.find(edge) == previous_edges.end())
+      add_edge(edge);
+
   m_graph->relinkGraph();
-  */
+}
+
+void GfxContext::add_node_edges(int32_t index)
+{
+  // Edges may have been received before the node was created
+  for(const auto& edge : edges)
+    if(edge.first.node == index || edge.second.node == index)
+      add_edge(edge);
 }
 
 void GfxContext::update_inputs()
@@ -248,7 +275,10 @@ void GfxContext::remove_node(
   for(auto it = this->edges.begin(); it != this->edges.end();)
   {
     if(it->first.node == index || it->second.node == index)
+    {
+      remove_edge(*it);
       it = this->edges.erase(it);
+    }
     else
       ++it;
   }
@@ -265,6 +295,9 @@ void GfxContext::remove_node(
       else
         ++timer_it;
     }
+    ossia::remove_erase_if(
+        m_offlineOutputs, [node](const auto& out) { return out.node == node; });
+    update_offline_period();
 
     m_graph->removeNode(node);
 
@@ -282,6 +315,7 @@ void GfxContext::run_commands()
   std::vector<std::unique_ptr<score::gfx::Node>> nursery;
 
   bool recompute = false;
+  bool relink = false;
   std::vector<score::gfx::Node*> add_output;
   Command c = NodeCommand{};
   while(tick_commands.try_dequeue(c))
@@ -298,9 +332,15 @@ void GfxContext::run_commands()
           break;
         }
         case NodeCommand::ADD_NODE: {
+          // New outputs need their own render list,
+          // other nodes are only linked to the existing ones
+          if(dynamic_cast<score::gfx::OutputNode*>(cmd.node.get()))
+            recompute = true;
+          else
+            relink = true;
           m_graph->addNode(cmd.node.get());
           nodes[cmd.index] = {std::move(cmd.node)};
-          recompute = true;
+          add_node_edges(cmd.index);
           break;
         }
         case NodeCommand::REMOVE_PREVIEW_NODE: {
@@ -322,8 +362,13 @@ void GfxContext::run_commands()
           break;
         }
         case NodeCommand::REMOVE_NODE: {
+          if(auto it = nodes.find(cmd.index);
+             it != nodes.end()
+             && dynamic_cast<score::gfx::OutputNode*>(it->second.get()))
+            recompute = true;
+          else
+            relink = true;
           remove_node(nursery, cmd.index);
-          recompute = true;
           break;
         }
         case NodeCommand::RELINK: {
@@ -357,6 +402,9 @@ void GfxContext::run_commands()
   }
   else
   {
+    if(relink)
+      m_graph->relinkGraph();
+
     for(auto* out : add_output)
       add_preview_output(*safe_cast<score::gfx::OutputNode*>(out));
   }
@@ -379,12 +427,121 @@ void GfxContext::updateGraph()
 
   if(edges_changed)
   {
+    const auto previous_edges = edges;
     {
       std::lock_guard l{edges_lock};
       std::swap(edges, new_edges);
     }
-    recompute_connections();
+    recompute_connections(previous_edges);
     edges_changed = false;
+
+#if !defined(SCORE_DEPLOYMENT_BUILD)
+    if(qEnvironmentVariableIsSet("SCORE_GFX_STATISTICS"))
+    {
+      const auto& st = m_graph->statistics();
+      qDebug() << "Gfx renderers: created" << st.created << "initialized"
+               << st.initialized << "released" << st.released << "deleted"
+               << st.deleted;
+    }
+#endif
+  }
+}
+
+void GfxContext::update_offline_period()
+{
+  double period = 0.;
+  for(const auto& out : m_offlineOutputs)
+    if(period == 0. || out.period < period)
+      period = out.period;
+  m_offlinePeriod = period;
+}
+
+void GfxContext::start_offline()
+{
+  {
+    std::lock_guard l{m_offlineLock};
+    m_offlineCancelled = false;
+  }
+
+  m_nextOfflineFrame = 0.;
+  for(auto& out : m_offlineOutputs)
+  {
+    out.next = -1.;
+    out.node->startOfflineRendering();
+  }
+  m_offline = true;
+}
+
+void GfxContext::stop_offline()
+{
+  m_offline = false;
+  {
+    std::lock_guard l{m_offlineLock};
+    m_offlineCancelled = true;
+  }
+  m_offlineRendered.notify_all();
+
+  // The frames rendered after this point are not written anymore
+  for(auto& out : m_offlineOutputs)
+    out.node->stopOfflineRendering();
+}
+
+void GfxContext::render_offline_frames(double seconds)
+{
+  // The realtime clocks never wait for the rendering
+  if(!m_offline)
+    return;
+
+  const double period = m_offlinePeriod;
+  if(period <= 0.)
+    return;
+
+  // The execution went back in time
+  if(seconds + period < m_nextOfflineFrame)
+    m_nextOfflineFrame = 0.;
+  if(seconds < m_nextOfflineFrame)
+    return;
+  while(m_nextOfflineFrame <= seconds)
+    m_nextOfflineFrame += period;
+
+  std::unique_lock lck{m_offlineLock};
+  if(m_offlineCancelled)
+    return;
+
+  const int64_t request = ++m_offlineRequest;
+  auto render = [this, seconds, request] {
+    if(m_offline)
+      render_offline(seconds);
+    {
+      std::lock_guard l{m_offlineLock};
+      m_offlineDone = request;
+    }
+    m_offlineRendered.notify_all();
+  };
+  QMetaObject::invokeMethod(this, std::move(render), Qt::QueuedConnection);
+
+  // Only stopping the clock, from the main thread, interrupts the wait
+  m_offlineRendered.wait(
+      lck, [&] { return m_offlineDone >= request || m_offlineCancelled; });
+}
+
+void GfxContext::render_offline(double seconds)
+{
+  // Apply what the execution sent up to now
+  updateGraph();
+
+  for(auto& out : m_offlineOutputs)
+  {
+    // New outputs start at the current time, and so does a restarted execution
+    if(out.next < 0. || seconds + out.period < out.next)
+      out.next = seconds;
+
+    // Ticks longer than a frame leave several frames due at once
+    while(out.next <= seconds)
+    {
+      out.node->render();
+      out.next += out.period;
+    }
   }
 }
 
@@ -13,6 +13,8 @@
 
 #include <concurrentqueue.h>
 #include <score_plugin_gfx_export.h>
+
+#include <condition_variable>
 namespace score::gfx
 {
 struct Graph;
@@ -47,11 +49,20 @@ public:
 
   void recompute_edges();
   void recompute_graph();
-  void recompute_connections();
+  void recompute_connections(const ossia::flat_set<Edge>& previous_edges);
 
   void update_inputs();
   void updateGraph();
 
+  //! Called from the execution thread at the end of each tick:
+  //! with the offline clock, waits for the offline outputs to render
+  //! the frames due at that time
+  void render_offline_frames(double seconds);
+
+  //! Called from the main thread when the offline clock starts and stops
+  void start_offline();
+  void stop_offline();
+
   void send_message(score::gfx::Message&& msg) noexcept
   {
     tick_messages.enqueue(std::move(msg));
@@ -63,7 +74,10 @@ private:
   void remove_preview_output();
   void add_edge(Edge e);
   void remove_edge(Edge e);
+  void add_node_edges(int32_t id);
   void remove_node(std::vector<std::unique_ptr<score::gfx::Node>>& nursery, int32_t id);
+  void render_offline(double seconds);
+  void update_offline_period();
 
   void timerEvent(QTimerEvent*) override;
   const score::DocumentContext& m_context;
@@ -111,6 +125,27 @@ private:
 
   ossia::flat_map<int, score::gfx::OutputNode*> m_manualTimers;
 
+  struct OfflineOutput
+  {
+    score::gfx::OutputNode* node{};
+    double period{};
+    double next{-1.};
+  };
+  std::vector<OfflineOutput> m_offlineOutputs;
+
+  // Shortest period of the offline outputs in seconds, 0 if there are none
+  std::atomic<double> m_offlinePeriod{};
+  double m_nextOfflineFrame{};
+
+  // Only the offline clock waits for the offline outputs
+  std::atomic_bool m_offline{};
+
+  std::mutex m_offlineLock;
+  std::condition_variable m_offlineRendered;
+  int64_t m_offlineRequest{};
+  int64_t m_offlineDone{};
+  bool m_offlineCancelled{};
+
   ossia::object_pool<std::vector<score::gfx::gfx_input>> m_buffers;
 };
 
@@ -24,6 +24,8 @@ public:
   void startTick(const ossia::audio_tick_state& st) override;
   void setEdge(port_index source, port_index sink);
   void endTick(const ossia::audio_tick_state& st) override;
+  void offlineStarted() override;
+  void offlineStopped() override;
 
   GfxContext* ui{};
   std::vector<Edge> prev_edges;
@@ -75,5 +75,17 @@ void GfxExecutionAction::endTick(const ossia::audio_tick_state& st)
       ui->edges_changed = true;
     }
   }
+
+  ui->render_offline_frames(st.seconds);
+}
+
+void GfxExecutionAction::offlineStarted()
+{
+  ui->start_offline();
+}
+
+void GfxExecutionAction::offlineStopped()
+{
+  ui->stop_offline();
 }
 }
@@ -141,6 +141,7 @@ void Graph::createAllRenderLists(GraphicsApi graphicsApi)
 
   m_renderers.clear();
   m_outputs.clear();
+  m_dirtyNodes.clear();
 
   for(auto node : m_nodes)
     if(auto out = dynamic_cast<OutputNode*>(node))
@@ -250,86 +251,131 @@ void Graph::initializeOutput(OutputNode* output, GraphicsApi graphicsApi)
   }
 }
 
-void Graph::relinkGraph()
+void Graph::markDirty(score::gfx::Node* n)
 {
-  for(auto r_it = m_renderers.begin(); r_it != m_renderers.end();)
+  if(!ossia::contains(m_dirtyNodes, n))
+    m_dirtyNodes.push_back(n);
+}
+
+bool Graph::relinkRenderList(RenderList& r)
+{
+  for(auto& node : m_nodes)
+    node->addedToGraph = false;
+
+  const auto old_nodes = std::move(r.nodes);
+  r.nodes.clear();
+  r.nodes.push_back(&r.output);
+
+  // In which order do we want to render stuff
+  graphwalk(r.nodes);
+
+  // Free the renderers of the nodes which do not render to this output anymore
+  for(auto node : old_nodes)
   {
-    auto& r = **r_it;
-    for(auto& node : m_nodes)
-      node->addedToGraph = false;
+    if(ossia::contains(r.nodes, node))
+      continue;
 
-    assert(!r.nodes.empty());
+    if(auto it = node->renderedNodes.find(&r); it != node->renderedNodes.end())
+    {
+      it->second->release(r);
+      delete it->second;
+      node->renderedNodes.erase(it);
+      node->renderedNodesChanged();
+      m_statistics.released++;
+      m_statistics.deleted++;
+    }
+  }
 
-    auto out = r.nodes.back();
-    r.nodes.clear();
-    r.nodes.push_back(out);
+  const std::size_t n = r.nodes.size();
+  ossia::hash_map<score::gfx::Node*, std::size_t> index;
+  for(std::size_t i = 0; i < n; i++)
+    index[r.nodes[i]] = i;
 
-    r.clearRenderers();
+  std::vector<score::gfx::NodeRenderer*> renderers;
+  renderers.reserve(n);
+  std::vector<char> created(n), reinit(n);
+  bool invalid_renderlist = false;
+  for(std::size_t i = 0; i < n; i++)
+  {
+    auto node = r.nodes[i];
+    if(auto it = node->renderedNodes.find(&r); it != node->renderedNodes.end())
+    {
+      renderers.push_back(it->second);
+      reinit[i] = ossia::contains(m_dirtyNodes, node);
+    }
+    else if(auto rn = node->createRenderer(r))
+    {
+      node->renderedNodes.emplace(&r, rn);
+      node->renderedNodesChanged();
+      m_statistics.created++;
+      renderers.push_back(rn);
+      created[i] = true;
+      reinit[i] = true;
+    }
+    else
+    {
+      invalid_renderlist = true;
+      break;
+    }
+  }
 
-    auto& model_nodes = r.nodes;
+  r.renderers = std::move(renderers);
+  if(invalid_renderlist)
+  {
+    r.release();
+    return false;
+  }
+
+  // A renderer creates one pass per outgoing edge, which draws into the
+  // render target of the edge's sink: when the sink's render targets are
+  // recreated, the nodes rendering into it have to follow.
+  // Sinks come before their sources in the list, thus a single pass suffices.
+  for(std::size_t i = 0; i < n; i++)
+  {
+    if(!reinit[i])
+      continue;
+    for(auto input : r.nodes[i]->input)
+      for(auto edge : input->edges)
+        if(auto it = index.find(edge->source->node); it != index.end())
+          reinit[it->second] = true;
+  }
+
+  for(std::size_t i = 0; i < n; i++)
+  {
+    if(reinit[i] && !created[i])
     {
-      // In which order do we want to render stuff
-      graphwalk(model_nodes);
+      r.renderers[i]->release(r);
+      m_statistics.released++;
+    }
+  }
 
-      if(model_nodes.size() > 1)
-      {
-        bool invalid_renderlist = false;
-        for(auto node : model_nodes)
-        {
-          score::gfx::NodeRenderer* rn{};
-          auto it = node->renderedNodes.find(&r);
-          if(it == node->renderedNodes.end())
-          {
-            if((rn = node->createRenderer(r)))
-            {
-              node->renderedNodes.emplace(&r, rn);
-              node->renderedNodesChanged();
-              //rn->init(r);
-            }
-            else
-            {
-              invalid_renderlist = true;
-              break;
-            }
-          }
-          else
-          {
-            rn = it->second;
-            SCORE_ASSERT(rn);
-            rn->release(r);
-            //rn->init(r);
-          }
-          SCORE_ASSERT(rn);
-          r.renderers.push_back(rn);
-        }
-
-        // If a node couldn't be recreated, we skip the whole thing
-        if(invalid_renderlist)
-        {
-          r.output.setRenderer({});
-          r_it = m_renderers.erase(r_it);
-          break;
-        }
+  // Render targets must exist before the pipelines rendering into them
+  for(std::size_t i = 0; i < n; i++)
+  {
+    if(reinit[i])
+      r.initRenderer(*r.renderers[i]);
+  }
 
-        //         for(auto node : r.renderers)
-        //         {
-        //           node->init(r);
-        //         }
-      }
-      else if(model_nodes.size() == 1)
-      {
-        SCORE_ASSERT(
-            model_nodes[0]->renderedNodes.find(&r)
-            != model_nodes[0]->renderedNodes.end());
-        auto rn = model_nodes[0]->renderedNodes.find(&r)->second;
-        SCORE_ASSERT(rn);
-        rn->release(r);
-      }
+  return true;
+}
+
+void Graph::relinkGraph()
+{
+  for(auto r_it = m_renderers.begin(); r_it != m_renderers.end();)
+  {
+    auto& r = **r_it;
+    if(!relinkRenderList(r))
+    {
+      // If a node couldn't be created, we skip the whole thing
+      r.output.setRenderer({});
+      r_it = m_renderers.erase(r_it);
+      continue;
     }
-    r.output.onRendererChange();
 
+    r.output.onRendererChange();
     ++r_it;
   }
+  m_dirtyNodes.clear();
 
   if(m_outputs.size() > m_renderers.size())
   {
@@ -358,6 +404,8 @@ static bool createNodeRenderer(score::gfx::Node& node, RenderList& r)
   if(auto rn = node.createRenderer(r))
   {
     r.renderers.push_back(rn);
+    if(r.statistics)
+      r.statistics->created++;
 
     // Register the rendered nodes with their parents
     SCORE_ASSERT(node.renderedNodes.find(&r) == node.renderedNodes.end());
@@ -373,6 +421,7 @@ std::shared_ptr<RenderList>
 Graph::createRenderList(OutputNode* output, std::shared_ptr<RenderState> state)
 {
   auto ptr = std::make_shared<RenderList>(*output, state);
+  ptr->statistics = &m_statistics;
   output->setRenderer(ptr);
   for(auto& node : m_nodes)
     node->addedToGraph = false;
@@ -407,6 +456,7 @@ Graph::createRenderList(OutputNode* output, std::shared_ptr<RenderState> state)
       auto batch = r.initialBatch();
       for(auto node : r.renderers)
         node->init(r, *batch);
+      m_statistics.initialized += r.renderers.size();
     }
   }
 
@@ -420,6 +470,7 @@ Graph::~Graph()
   for(auto& renderer : m_renderers)
   {
     renderer->release();
+    renderer->statistics = nullptr;
   }
 
   for(auto out : m_outputs)
@@ -438,12 +489,14 @@ void Graph::addNode(Node* n)
 void Graph::removeNode(Node* n)
 {
   ossia::remove_erase(m_nodes, n);
+  ossia::remove_erase(m_dirtyNodes, n);
 }
 
 void Graph::clearEdges()
 {
   for(auto edge : m_edges)
   {
+    markDirty(edge->source->node);
     delete edge;
   }
   m_edges.clear();
@@ -457,6 +510,7 @@ void Graph::addEdge(Port* source, Port* sink)
   if(it == m_edges.end())
   {
     m_edges.push_back(new Edge{source, sink});
+    markDirty(source->node);
   }
 #if defined(SCORE_DEBUG)
   else
@@ -473,6 +527,7 @@ void Graph::removeEdge(Port* source, Port* sink)
       m_edges, [=](Edge* e) { return e->source == source && e->sink == sink; });
   if(it != m_edges.end())
   {
+    markDirty(source->node);
     delete *it;
     m_edges.erase(it);
   }
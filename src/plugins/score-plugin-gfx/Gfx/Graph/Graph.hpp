@@ -72,7 +72,11 @@ struct SCORE_PLUGIN_GFX_EXPORT Graph
   void destroyOutputRenderList(score::gfx::OutputNode& node);
 
   /**
-   * @brief Recreate the connections between renderers when edges changed.
+   * @brief Update the renderers after nodes or edges changed.
+   *
+   * Only the renderers affected by the changes since the last relink are
+   * created, released or reinitialized: the others keep their pipelines
+   * and render targets.
    */
   void relinkGraph();
 
@@ -94,10 +98,17 @@ struct SCORE_PLUGIN_GFX_EXPORT Graph
     return m_renderers;
   }
 
+  /**
+   * @brief Renderer operations since the creation of the graph.
+   */
+  const RenderStatistics& statistics() const noexcept { return m_statistics; }
+
 private:
   void initializeOutput(OutputNode* output, GraphicsApi graphicsApi);
   void createOutputRenderList(OutputNode& output);
   void recreateOutputRenderList(OutputNode& output);
+  bool relinkRenderList(RenderList& r);
+  void markDirty(score::gfx::Node* n);
   std::shared_ptr<RenderList>
   createRenderList(OutputNode*, std::shared_ptr<RenderState> state);
 
@@ -109,5 +120,9 @@ private:
   std::vector<Edge*> m_edges;
 
   std::vector<OutputNode*> m_outputs;
+
+  //! Nodes whose renderers must be reinitialized on the next relink
+  std::vector<score::gfx::Node*> m_dirtyNodes;
+  RenderStatistics m_statistics;
 };
 }
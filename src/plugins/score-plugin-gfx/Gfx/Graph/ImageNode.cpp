@@ -2,12 +2,16 @@
 #include <Gfx/Graph/NodeRenderer.hpp>
 #include <Gfx/Graph/RenderList.hpp>
 #include <Gfx/Graph/RenderState.hpp>
+#include <Gfx/Images/ImageStream.hpp>
 #include <Gfx/Images/Process.hpp>
 
+#include <ossia/detail/algorithms.hpp>
 #include <ossia/detail/math.hpp>
 #include <ossia/gfx/port_index.hpp>
 #include <ossia/network/value/value_conversion.hpp>
 
+#include <list>
+
 namespace score::gfx
 {
 static int imageIndex(int idx, int size)
@@ -147,7 +151,10 @@ void main ()
   fragColor = tex * mat.opacity;
 }
 )_";
-ImagesNode::ImagesNode()
+ImagesNode::ImagesNode(bool streaming, int64_t cacheBytes, int threads)
+    : cacheBytes{cacheBytes}
+    , threads{threads}
+    , streaming{streaming}
 {
   input.push_back(new Port{this, &ubo.currentImageIndex, Types::Int, {}});
   input.push_back(new Port{this, &ubo.opacity, Types::Float, {}});
@@ -177,14 +184,7 @@ void ImagesNode::process(Message&& msg)
               [this, sink](const auto& v) { ProcessNode::process(sink.port, v); },
               std::move(m));
 
-          if(linearImages.size() > 0)
-          {
-            const int idx = imageIndex(ubo.currentImageIndex, linearImages.size());
-            auto sz = linearImages[idx]->size();
-            ubo.imageSize[0] = sz.width();
-            ubo.imageSize[1] = sz.height();
-          }
-
+          updateImageSize();
           break;
         }
         case 1: // Opacity
@@ -224,6 +224,12 @@ void ImagesNode::process(Message&& msg)
 
         case 5: // Images
         {
+          if(streaming)
+          {
+            stream = std::make_shared<Gfx::ImageStream>(
+                Gfx::getImagePaths(*val), cacheBytes, threads);
+          }
+          else
           {
             linearImages.clear();
             Gfx::releaseImages(images);
@@ -235,17 +241,10 @@ void ImagesNode::process(Message&& msg)
                 linearImages.push_back(&frame);
               }
             }
-
-            if(linearImages.size() > 0)
-            {
-              const int idx = imageIndex(ubo.currentImageIndex, linearImages.size());
-              auto sz = linearImages[idx]->size();
-              ubo.imageSize[0] = sz.width();
-              ubo.imageSize[1] = sz.height();
-            }
-
-            ++this->imagesChanged;
           }
+
+          updateImageSize();
+          ++this->imagesChanged;
           break;
         }
 
@@ -264,6 +263,26 @@ void ImagesNode::process(Message&& msg)
   }
 }
 
+void ImagesNode::updateImageSize()
+{
+  QSize sz;
+  if(stream)
+  {
+    sz = stream->frameSize();
+  }
+  else if(linearImages.size() > 0)
+  {
+    const int idx = imageIndex(ubo.currentImageIndex, linearImages.size());
+    sz = linearImages[idx]->size();
+  }
+
+  if(!sz.isEmpty())
+  {
+    ubo.imageSize[0] = sz.width();
+    ubo.imageSize[1] = sz.height();
+  }
+}
+
 ImagesNode::~ImagesNode()
 {
   Gfx::releaseImages(images);
@@ -683,8 +702,258 @@ private:
   bool m_uploaded = false;
 };
 
+class ImagesNode::StreamingRenderer : public GenericNodeRenderer
+{
+public:
+  using GenericNodeRenderer::GenericNodeRenderer;
+
+private:
+  ~StreamingRenderer() { }
+
+  int imagesChanged = -1;
+  ImageMode tile{};
+
+  struct CachedTexture
+  {
+    int index{};
+    QRhiTexture* texture{};
+    int64_t bytes{};
+  };
+
+  TextureRenderTarget renderTargetForInput(const Port& p) override { return {}; }
+  void init(RenderList& renderer, QRhiResourceUpdateBatch& res) override
+  {
+    auto& n = static_cast<const ImagesNode&>(this->node);
+    const auto& rs = renderer.state;
+    const auto& mesh = renderer.defaultQuad();
+    defaultMeshInit(renderer, mesh, res);
+    processUBOInit(renderer);
+    m_material.init(renderer, node.input, m_samplers);
+
+    QRhi& rhi = *renderer.state.rhi;
+
+    tile = n.tile;
+    QShader &v = m_vertexS, &f = m_fragmentS;
+    if(!tile)
+      std::tie(v, f) = score::gfx::makeShaders(
+          rs, images_single_vertex_shader, images_single_fragment_shader);
+    else
+      std::tie(v, f) = score::gfx::makeShaders(
+          rs, TexturedTriangle{}.defaultVertexShader(), images_tiled_fragment_shader);
+
+    // The frames are bound to the sampler as they get decoded
+    m_current = &renderer.emptyTexture();
+    m_samplers.push_back({createSampler(tile, rhi), m_current});
+
+    // Initialize the passes for the "single" case
+    defaultPassesInit(renderer, mesh);
+
+    // Initialize the passes for the "tiled" case
+    {
+      auto [v, f] = score::gfx::makeShaders(
+          rs, TexturedTriangle{}.defaultVertexShader(), images_tiled_fragment_shader);
+      for(Edge* edge : this->node.output[0]->edges)
+      {
+        auto rt = renderer.renderTargetForOutput(*edge);
+        if(rt.renderTarget)
+        {
+          m_altPasses.emplace_back(
+              edge, score::gfx::buildPipeline(
+                        renderer, mesh, v, f, rt, m_processUBO, m_material.buffer,
+                        m_samplers));
+        }
+      }
+    }
+  }
+
+  void setTexture(QRhiTexture* tex)
+  {
+    auto replace_texture = [](PassMap& passes, QRhiSampler* sampler, QRhiTexture* tex) {
+      for(auto& pass : passes)
+        score::gfx::replaceTexture(*pass.second.srb, sampler, tex);
+    };
+
+    QRhiSampler* sampler = m_samplers[0].sampler;
+    replace_texture(m_p, sampler, tex);
+    replace_texture(m_altPasses, sampler, tex);
+    m_samplers[0].texture = tex;
+    m_current = tex;
+  }
+
+  // Returns the texture of the frame if it could be uploaded
+  QRhiTexture* texture(RenderList& renderer, QRhiResourceUpdateBatch& res, int idx)
+  {
+    auto& n = static_cast<const ImagesNode&>(this->node);
+
+    // Also keeps the decoding going ahead of the playhead
+    auto frame = m_stream->frame(idx);
+
+    auto it
+        = ossia::find_if(m_textures, [idx](const auto& t) { return t.index == idx; });
+    if(it != m_textures.end())
+    {
+      m_textures.splice(m_textures.begin(), m_textures, it);
+      return it->texture;
+    }
+
+    if(!frame || frame->size.isEmpty())
+      return nullptr;
+
+    QRhi& rhi = *renderer.state.rhi;
+    const bool compressed = !frame->compressed.isEmpty();
+    if(!rhi.isTextureFormatSupported(frame->format))
+      return nullptr;
+
+    QSize size = frame->size;
+    if(!compressed)
+    {
+      const int limits_min = rhi.resourceLimit(QRhi::ResourceLimit::TextureSizeMin);
+      const int limits_max = rhi.resourceLimit(QRhi::ResourceLimit::TextureSizeMax);
+      size = resizeTextureSize(size, limits_min, limits_max);
+    }
+
+    // The textures are only kept for loops and scrubbing:
+    // the frames ahead of the playhead wait on the CPU side
+    const int64_t budget = n.cacheBytes / 4;
+    const int64_t bytes = frame->bytes();
+    QRhiTexture* tex{};
+    while(!m_textures.empty() && m_textureBytes + bytes > budget)
+    {
+      auto& last = m_textures.back();
+      if(last.texture == m_current)
+        break;
+
+      // Textures of the same size and format are recycled
+      if(!tex && last.texture->pixelSize() == size
+         && last.texture->format() == frame->format)
+        tex = last.texture;
+      else
+        last.texture->deleteLater();
+
+      m_textureBytes -= last.bytes;
+      m_textures.pop_back();
+    }
+
+    if(!tex)
+    {
+      tex = rhi.newTexture(frame->format, size, 1, QRhiTexture::Flag{});
+      tex->setName("ImagesNode::StreamingRenderer::tex");
+      tex->create();
+    }
+
+    if(compressed)
+    {
+      QRhiTextureSubresourceUploadDescription sub{frame->compressed};
+      res.uploadTexture(tex, QRhiTextureUploadDescription{{0, 0, sub}});
+    }
+    else
+    {
+      res.uploadTexture(tex, renderer.adaptImage(frame->image));
+    }
+
+    m_textures.push_front({idx, tex, bytes});
+    m_textureBytes += bytes;
+    return tex;
+  }
+
+  void releaseTextures()
+  {
+    for(auto& t : m_textures)
+      t.texture->deleteLater();
+    m_textures.clear();
+    m_textureBytes = 0;
+  }
+
+  void update(RenderList& renderer, QRhiResourceUpdateBatch& res) override
+  {
+    auto& n = static_cast<const ImagesNode&>(this->node);
+
+    if(n.tile != tile)
+    {
+      tile = n.tile;
+      auto [s, tex] = m_samplers[0];
+
+      m_samplers.clear();
+
+      // Create a new sampler
+      auto new_sampler = createSampler(tile, *renderer.state.rhi);
+      m_samplers.push_back({new_sampler, tex});
+
+      // Replace it in the render passes
+      auto replace_sampler = [](PassMap& passes, QRhiSampler* oldS, QRhiSampler* newS) {
+        for(auto& pass : passes)
+          score::gfx::replaceSampler(*pass.second.srb, oldS, newS);
+      };
+
+      replace_sampler(m_p, s, new_sampler);
+      replace_sampler(m_altPasses, s, new_sampler);
+
+      // Release the old sampler
+      s->deleteLater();
+    }
+
+    if(n.imagesChanged > imagesChanged)
+    {
+      imagesChanged = n.imagesChanged;
+      m_stream = n.stream;
+      setTexture(&renderer.emptyTexture());
+      releaseTextures();
+      m_currentIndex = -1;
+    }
+
+    // If the next frame is not decoded yet, the previous one stays on screen
+    if(m_stream && m_stream->frames() > 0)
+    {
+      const int idx = imageIndex(n.ubo.currentImageIndex, m_stream->frames());
+      if(idx != m_currentIndex)
+      {
+        if(auto tex = texture(renderer, res, idx))
+        {
+          setTexture(tex);
+          m_currentIndex = idx;
+        }
+      }
+    }
+
+    GenericNodeRenderer::update(renderer, res);
+  }
+
+  void runRenderPass(RenderList& renderer, QRhiCommandBuffer& cb, Edge& edge) override
+  {
+    const auto& mesh = renderer.defaultQuad();
+    if(tile == ImageMode::Single)
+      defaultRenderPass(renderer, mesh, cb, edge, m_p);
+    else
+      defaultRenderPass(renderer, mesh, cb, edge, m_altPasses);
+  }
+
+  void release(RenderList& r) override
+  {
+    releaseTextures();
+    m_current = nullptr;
+    m_currentIndex = -1;
+
+    defaultRelease(r);
+
+    {
+      for(auto& pass : m_altPasses)
+        pass.second.release();
+      m_altPasses.clear();
+    }
+  }
+
+  ossia::small_vector<std::pair<Edge*, Pipeline>, 2> m_altPasses;
+  std::shared_ptr<Gfx::ImageStream> m_stream;
+  std::list<CachedTexture> m_textures;
+  int64_t m_textureBytes{};
+  QRhiTexture* m_current{};
+  int m_currentIndex{-1};
+};
+
 NodeRenderer* ImagesNode::createRenderer(RenderList& r) const noexcept
 {
+  if(streaming)
+    return new StreamingRenderer{*this};
   return new PreloadedRenderer{*this};
 }
 
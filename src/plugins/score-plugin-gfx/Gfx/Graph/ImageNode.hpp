@@ -2,6 +2,10 @@
 
 #include <Gfx/Graph/Node.hpp>
 
+namespace Gfx
+{
+class ImageStream;
+}
 namespace score::gfx
 {
 enum ImageMode
@@ -14,17 +18,22 @@ enum ImageMode
 
 /**
  * @brief A node that renders an image to screen.
+ *
+ * In streaming mode, the frames are decoded ahead of the playhead
+ * instead of being all loaded and uploaded at once: this is used
+ * for the sequences which do not fit in the cache budget.
  */
 struct ImagesNode : NodeModel
 {
 public:
-  explicit ImagesNode();
+  explicit ImagesNode(bool streaming = false, int64_t cacheBytes = 0, int threads = 1);
   virtual ~ImagesNode();
 
   score::gfx::NodeRenderer* createRenderer(RenderList& r) const noexcept override;
 
   class PreloadedRenderer;
   class OnTheFlyRenderer;
+  class StreamingRenderer;
 
 #pragma pack(push, 1)
   struct UBO
@@ -42,9 +51,15 @@ public:
 
 private:
   void process(Message&& msg) override;
+  void updateImageSize();
 
   std::vector<score::gfx::Image> images;
   std::vector<QImage*> linearImages;
+
+  std::shared_ptr<Gfx::ImageStream> stream;
+  int64_t cacheBytes{};
+  int threads{1};
+  bool streaming{};
 };
 struct FullScreenImageNode : NodeModel
 {
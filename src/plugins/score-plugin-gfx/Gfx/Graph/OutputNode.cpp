@@ -8,6 +8,10 @@ OutputNode::~OutputNode() { }
 
 void OutputNode::updateGraphicsAPI(GraphicsApi) { }
 
+void OutputNode::startOfflineRendering() { }
+
+void OutputNode::stopOfflineRendering() { }
+
 OutputNodeRenderer::~OutputNodeRenderer() { }
 
 void OutputNodeRenderer::finishFrame(
@@ -49,11 +49,20 @@ public:
     // If set, the host is responsible for calling render() at this
     // rate (given in milliseconds)
     std::optional<double> manualRenderingRate;
+
+    // If set, the manual rendering rate is counted in execution time:
+    // the execution waits for each frame to be rendered before going on.
+    bool offline{};
     bool outputNeedsRenderPass{};
   };
 
   virtual Configuration configuration() const noexcept = 0;
 
+  //! For offline outputs: the offline clock starts or stops,
+  //! e.g. to begin and finish the file they write to
+  virtual void startOfflineRendering();
+  virtual void stopOfflineRendering();
+
 protected:
   explicit OutputNode();
 };
@@ -67,6 +67,8 @@ RenderList::~RenderList()
   {
     delete node;
   }
+  if(statistics)
+    statistics->deleted += renderers.size();
   renderers.clear();
 }
 
@@ -109,6 +111,8 @@ void RenderList::release()
   {
     node->release(*this);
   }
+  if(statistics)
+    statistics->released += renderers.size();
 
   for(auto bufs : m_vertexBuffers)
   {
@@ -155,6 +159,8 @@ void RenderList::maybeRebuild()
     {
       node->init(*this, *this->m_initialBatch);
     }
+    if(statistics)
+      statistics->initialized += renderers.size();
 
     m_lastSize = outputSize;
     m_built = true;
@@ -226,6 +232,20 @@ void RenderList::clearRenderers()
   m_built = false;
 }
 
+void RenderList::initRenderer(NodeRenderer& renderer)
+{
+  if(!m_built)
+    return;
+
+  // Consumed by the next call to render()
+  if(!m_initialBatch)
+    m_initialBatch = state.rhi->nextResourceUpdateBatch();
+
+  renderer.init(*this, *m_initialBatch);
+  if(statistics)
+    statistics->initialized++;
+}
+
 const Mesh& RenderList::defaultQuad() const noexcept
 {
   static const TexturedQuad m{true};
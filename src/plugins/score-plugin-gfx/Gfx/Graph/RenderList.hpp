@@ -6,6 +6,20 @@ namespace score::gfx
 {
 
 class OutputNode;
+
+/**
+ * @brief Counts the operations done on the node renderers.
+ *
+ * Used to measure how much work graph edits cause.
+ */
+struct RenderStatistics
+{
+  int64_t created{};
+  int64_t initialized{};
+  int64_t released{};
+  int64_t deleted{};
+};
+
 /**
  * @brief List of nodes to be rendered to an output.
  *
@@ -105,6 +119,18 @@ public:
   /** @brief Clear the renderers so that they get reinitialized on the next frame */
   void clearRenderers();
 
+  /**
+   * @brief Initialize a renderer added or changed after this list was built.
+   *
+   * If the list is not built yet, all its renderers get initialized on the next frame.
+   */
+  void initRenderer(NodeRenderer& renderer);
+
+  /**
+   * @brief Where operations on renderers are counted, if set.
+   */
+  RenderStatistics* statistics{};
+
   /**
    * @brief Texture to use when a texture is missing
    */
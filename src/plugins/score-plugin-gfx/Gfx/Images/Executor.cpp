@@ -9,6 +9,7 @@
 #include <Gfx/Graph/ImageNode.hpp>
 #include <Gfx/Images/ImageListChooser.hpp>
 #include <Gfx/Images/Process.hpp>
+#include <Gfx/Settings/Model.hpp>
 #include <Gfx/TexturePort.hpp>
 
 #include <score/document/DocumentContext.hpp>
@@ -20,10 +21,11 @@ namespace Gfx::Images
 class image_node final : public gfx_exec_node
 {
 public:
-  image_node(GfxExecutionAction& ctx)
+  image_node(GfxExecutionAction& ctx, bool streaming, int64_t cacheBytes, int threads)
       : gfx_exec_node{ctx}
   {
-    id = exec_context->ui->register_node(std::make_unique<score::gfx::ImagesNode>());
+    id = exec_context->ui->register_node(
+        std::make_unique<score::gfx::ImagesNode>(streaming, cacheBytes, threads));
   }
 
   ~image_node()
@@ -39,8 +41,12 @@ ProcessExecutorComponent::ProcessExecutorComponent(
     Gfx::Images::Model& element, const Execution::Context& ctx, QObject* parent)
     : ProcessComponent_T{element, ctx, "gfxExecutorComponent", parent}
 {
+  // The mode is chosen from the images set when the execution starts
+  auto& settings = ctx.doc.app.settings<Gfx::Settings::Model>();
   auto n = ossia::make_node<image_node>(
-      *ctx.execState, ctx.doc.plugin<DocumentPlugin>().exec);
+      *ctx.execState, ctx.doc.plugin<DocumentPlugin>().exec, element.streaming(),
+      int64_t(settings.getImageCacheSize()) * 1024 * 1024,
+      settings.getDecodingThreads());
 
   for(auto* outlet : element.outlets())
   {
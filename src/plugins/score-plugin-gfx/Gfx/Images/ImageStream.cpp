@@ -0,0 +1,250 @@
+#include "ImageStream.hpp"
+
+#include <ossia/detail/algorithms.hpp>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QtGui/private/qtexturefilereader_p.h>
+
+#include <algorithm>
+#include <optional>
+
+namespace Gfx
+{
+namespace
+{
+QRhiTexture::Format compressedFormat(quint32 glInternalFormat) noexcept
+{
+  switch(glInternalFormat)
+  {
+    case 0x83F0: // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    case 0x83F1: // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+      return QRhiTexture::BC1;
+    case 0x83F3: // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+      return QRhiTexture::BC3;
+    case 0x8E8C: // GL_COMPRESSED_RGBA_BPTC_UNORM
+      return QRhiTexture::BC7;
+    case 0x9274: // GL_COMPRESSED_RGB8_ETC2
+      return QRhiTexture::ETC2_RGB8;
+    case 0x9278: // GL_COMPRESSED_RGBA8_ETC2_EAC
+      return QRhiTexture::ETC2_RGBA8;
+    default:
+      return QRhiTexture::UnknownFormat;
+  }
+}
+
+std::optional<QTextureFileData> readCompressed(const QString& path)
+{
+  QFile file{path};
+  if(!file.open(QIODevice::ReadOnly))
+    return {};
+
+  QTextureFileReader reader{&file, path};
+  if(!reader.canRead())
+    return {};
+
+  auto data = reader.read();
+  if(!data.isValid())
+    return {};
+  return data;
+}
+
+int imageCount(const QString& path)
+{
+  // Only the animated formats have more than one image per file:
+  // this way the files of a long sequence do not all have to be opened
+  if(QFileInfo{path}.suffix().toLower() != "gif")
+    return 1;
+
+  QImageReader reader{path};
+  return std::max(reader.imageCount(), 1);
+}
+
+std::pair<QSize, int64_t> frameFootprint(const QString& path)
+{
+  if(ImageStream::isCompressedFile(path))
+  {
+    if(auto data = readCompressed(path))
+      return {data->size(), data->dataLength()};
+    return {};
+  }
+
+  const QSize sz = QImageReader{path}.size();
+  return {sz, int64_t(sz.width()) * sz.height() * 4};
+}
+}
+
+bool ImageStream::isCompressedFile(const QString& path) noexcept
+{
+  return QFileInfo{path}.suffix().toLower() == "ktx";
+}
+
+ImageStream::Estimate ImageStream::estimate(const std::vector<QString>& paths)
+{
+  Estimate e;
+  for(const auto& path : paths)
+  {
+    e.frames += imageCount(path);
+    e.compressed |= isCompressedFile(path);
+  }
+
+  if(!paths.empty())
+    e.bytes = frameFootprint(paths.front()).second * e.frames;
+  return e;
+}
+
+ImageStream::ImageStream(std::vector<QString> paths, int64_t budget, int threads)
+    : m_budget{budget}
+{
+  for(const auto& path : paths)
+  {
+    const int count = imageCount(path);
+    for(int i = 0; i < count; i++)
+      m_frames.push_back({path, i});
+  }
+
+  if(!m_frames.empty())
+  {
+    const auto [size, bytes] = frameFootprint(m_frames.front().path);
+    m_frameSize = size;
+
+    // Half of the budget goes to the frames ahead of the playhead,
+    // the other half keeps the recent ones for loops and scrubbing
+    m_lookahead
+        = std::clamp<int64_t>(m_budget / std::max<int64_t>(2 * bytes, 1), 1, 120);
+  }
+
+  for(int i = 0; i < std::max(threads, 1); i++)
+    m_threads.emplace_back([this] { run(); });
+}
+
+ImageStream::~ImageStream()
+{
+  {
+    std::lock_guard lck{m_mutex};
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  for(auto& t : m_threads)
+    t.join();
+}
+
+std::shared_ptr<const StreamedFrame> ImageStream::frame(int index)
+{
+  const int count = m_frames.size();
+  if(index < 0 || index >= count)
+    return {};
+
+  std::shared_ptr<const StreamedFrame> res;
+  bool requested = false;
+  {
+    std::lock_guard lck{m_mutex};
+    if(auto it = m_cached.find(index); it != m_cached.end())
+    {
+      m_lru.splice(m_lru.begin(), m_lru, it->second);
+      res = it->second->second;
+    }
+
+    if(index != m_lastRequest)
+    {
+      m_lastRequest = index;
+
+      // The requests made for the previous position of the playhead
+      // are not needed anymore
+      m_requests.clear();
+      for(int i = 0; i <= m_lookahead && i < count; i++)
+      {
+        const int k = (index + i) % count;
+        if(m_cached.find(k) == m_cached.end() && !ossia::contains(m_decoding, k))
+          m_requests.push_back(k);
+      }
+      requested = !m_requests.empty();
+    }
+  }
+
+  if(requested)
+    m_cv.notify_all();
+  return res;
+}
+
+void ImageStream::run()
+{
+  std::unique_lock lck{m_mutex};
+  for(;;)
+  {
+    m_cv.wait(lck, [this] { return m_stop || !m_requests.empty(); });
+    if(m_stop)
+      return;
+
+    const int index = m_requests.front();
+    m_requests.pop_front();
+    m_decoding.push_back(index);
+
+    lck.unlock();
+    auto frame = decode(m_frames[index]);
+    lck.lock();
+
+    ossia::remove_erase(m_decoding, index);
+    insert(index, std::move(frame));
+  }
+}
+
+std::shared_ptr<StreamedFrame> ImageStream::decode(const Source& src) const
+{
+  // A frame which cannot be read stays empty, so that it is not requested again
+  auto frame = std::make_shared<StreamedFrame>();
+  if(isCompressedFile(src.path))
+  {
+    if(auto data = readCompressed(src.path))
+    {
+      const auto format = compressedFormat(data->glInternalFormat());
+      if(format != QRhiTexture::UnknownFormat)
+      {
+        frame->compressed = data->data().mid(data->dataOffset(), data->dataLength());
+        frame->format = format;
+        frame->size = data->size();
+      }
+    }
+    return frame;
+  }
+
+  QImageReader reader{src.path};
+  reader.setBackgroundColor(Qt::transparent);
+  if(src.subImage > 0 && !reader.jumpToImage(src.subImage))
+  {
+    for(int i = 0; i < src.subImage && reader.canRead(); i++)
+      reader.read();
+  }
+
+  QImage img = reader.read();
+  if(img.isNull())
+    return frame;
+
+  if(img.format() != QImage::Format_ARGB32)
+    img.convertTo(QImage::Format_ARGB32);
+
+  frame->size = img.size();
+  frame->image = std::move(img);
+  return frame;
+}
+
+void ImageStream::insert(int index, std::shared_ptr<const StreamedFrame> frame)
+{
+  if(m_cached.find(index) != m_cached.end())
+    return;
+
+  m_cachedBytes += frame->bytes();
+  m_lru.emplace_front(index, std::move(frame));
+  m_cached[index] = m_lru.begin();
+
+  while(m_cachedBytes > m_budget && m_lru.size() > 1)
+  {
+    auto& [k, f] = m_lru.back();
+    m_cachedBytes -= f->bytes();
+    m_cached.erase(k);
+    m_lru.pop_back();
+  }
+}
+
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <Gfx/Graph/RenderState.hpp>
+
+#include <ossia/detail/hash_map.hpp>
+
+#include <QByteArray>
+#include <QImage>
+#include <QString>
+
+#include <score_plugin_gfx_export.h>
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Gfx
+{
+/**
+ * @brief A frame of an image sequence, decoded by an ImageStream
+ *
+ * Pre-transcoded frames (.ktx files) are kept in the GPU-compressed format
+ * they are stored in and uploaded as is: they are four to eight times smaller
+ * than the decoded images and cost nothing to decode.
+ */
+struct StreamedFrame
+{
+  QImage image;
+  QByteArray compressed;
+  QRhiTexture::Format format{QRhiTexture::BGRA8};
+  QSize size;
+
+  int64_t bytes() const noexcept
+  {
+    return compressed.isEmpty() ? image.sizeInBytes() : compressed.size();
+  }
+};
+
+/**
+ * @brief Decodes the frames of an image sequence ahead of the playhead
+ *
+ * Used by the Images process for sequences which do not fit in memory.
+ * The frames are decoded by worker threads and kept in a LRU cache bounded
+ * by a memory budget, thus the memory used does not depend on the length
+ * of the sequence.
+ */
+class SCORE_PLUGIN_GFX_EXPORT ImageStream
+{
+public:
+  struct Estimate
+  {
+    int frames{};
+    int64_t bytes{};
+    bool compressed{};
+  };
+
+  //! Only reads the headers of the files
+  static Estimate estimate(const std::vector<QString>& paths);
+  static bool isCompressedFile(const QString& path) noexcept;
+
+  ImageStream(std::vector<QString> paths, int64_t budget, int threads);
+  ~ImageStream();
+
+  ImageStream(const ImageStream&) = delete;
+  ImageStream& operator=(const ImageStream&) = delete;
+
+  int frames() const noexcept { return m_frames.size(); }
+
+  //! Size of the first frame: all the frames of a sequence have the same
+  QSize frameSize() const noexcept { return m_frameSize; }
+
+  /**
+   * @brief Returns the frame if it is already decoded, without waiting
+   *
+   * The decoding of the frames which follow it is scheduled, and the
+   * requests for frames which are not around the playhead anymore
+   * are cancelled.
+   */
+  std::shared_ptr<const StreamedFrame> frame(int index);
+
+private:
+  struct Source
+  {
+    QString path;
+    int subImage{};
+  };
+
+  void run();
+  std::shared_ptr<StreamedFrame> decode(const Source& src) const;
+  void insert(int index, std::shared_ptr<const StreamedFrame> frame);
+
+  std::vector<Source> m_frames;
+  QSize m_frameSize;
+  int64_t m_budget{};
+  int m_lookahead{1};
+
+  using Cache = std::list<std::pair<int, std::shared_ptr<const StreamedFrame>>>;
+  Cache m_lru;
+  ossia::hash_map<int, Cache::iterator> m_cached;
+  int64_t m_cachedBytes{};
+
+  std::deque<int> m_requests;
+  std::vector<int> m_decoding;
+  int m_lastRequest{-1};
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<std::thread> m_threads;
+  bool m_stop{};
+};
+
+}
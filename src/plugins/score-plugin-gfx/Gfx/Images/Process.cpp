@@ -6,6 +6,8 @@
 
 #include <Gfx/Graph/Node.hpp>
 #include <Gfx/Images/ImageListChooser.hpp>
+#include <Gfx/Images/ImageStream.hpp>
+#include <Gfx/Settings/Model.hpp>
 #include <Gfx/TexturePort.hpp>
 
 #include <ossia/detail/logger.hpp>
@@ -51,6 +53,14 @@ std::vector<score::gfx::Image> getImages(const ossia::value& val)
   }
   return imgs;
 }
+
+std::vector<QString> getImagePaths(const ossia::value& val)
+{
+  std::vector<QString> paths;
+  for(auto& img : ossia::convert<std::vector<ossia::value>>(val))
+    paths.push_back(QString::fromStdString(ossia::convert<std::string>(img)));
+  return paths;
+}
 }
 
 namespace Gfx::Images
@@ -114,14 +124,28 @@ Model::~Model()
 void Model::on_imagesChanged(const ossia::value& v)
 {
   releaseImages(m_currentImages);
-  m_currentImages = getImages(safe_cast<ImageListChooser*>(m_inlets[5])->value());
+
+  // Only the headers are read to know if the sequence fits in the cache
+  const auto& value = safe_cast<ImageListChooser*>(m_inlets[5])->value();
+  const auto estimate = ImageStream::estimate(getImagePaths(value));
+  auto& settings = score::AppContext().settings<Settings::Model>();
+  const int64_t budget = int64_t(settings.getImageCacheSize()) * 1024 * 1024;
+  m_streaming = estimate.compressed || estimate.bytes > budget;
 
   int count = 0;
-  for(const auto& img : m_currentImages)
-    count += img.frames.size();
+  if(m_streaming)
+  {
+    count = estimate.frames;
+  }
+  else
+  {
+    m_currentImages = getImages(value);
+    for(const auto& img : m_currentImages)
+      count += img.frames.size();
+  }
 
   auto spinbox = safe_cast<Process::IntSpinBox*>(m_inlets[0]);
-  if(!m_currentImages.empty())
+  if(count > 0)
     spinbox->setDomain(ossia::make_domain(int(0), int(count) - 1));
   else
     spinbox->setDomain(ossia::make_domain(int(0), int(0)));
@@ -139,12 +163,12 @@ QSet<QString> DropHandler::mimeTypes() const noexcept
 
 QSet<QString> LibraryHandler::acceptedFiles() const noexcept
 {
-  return {"png", "jpg", "jpe", "jpeg", "gif", "bmp"};
+  return {"png", "jpg", "jpe", "jpeg", "gif", "bmp", "ktx"};
 }
 
 QSet<QString> DropHandler::fileExtensions() const noexcept
 {
-  return {"png", "jpg", "jpe", "jpeg", "gif", "bmp"};
+  return {"png", "jpg", "jpe", "jpeg", "gif", "bmp", "ktx"};
 }
 
 static bool isSupportedImage(const QFileInfo& filepath)
@@ -192,19 +216,19 @@ void DropHandler::dropCustom(
   p.creation.key = Metadata<ConcreteKey_k, Gfx::Images::Model>::get();
   p.setup = [files = data.urls()](Process::ProcessModel& m, score::Dispatcher& disp) {
     auto& proc = static_cast<Model&>(m);
-    std::vector<score::gfx::Image> images;
 
+    // The images are only decoded by the model if they fit in the cache
+    std::vector<ossia::value> images;
     for(const auto& url : files)
     {
-      if(auto img = Gfx::ImageCache::instance().acquire(url.toLocalFile().toStdString()))
-      {
-        images.push_back(*std::move(img));
-      }
+      const QString path = url.toLocalFile();
+      if(isSupportedImage(QFileInfo{path}))
+        images.push_back(path.toStdString());
     }
 
     if(!images.empty())
       disp.submit(new Process::SetControlValue{
-          safe_cast<Process::ControlInlet&>(*proc.inlets()[5]), fromImageSet(images)});
+          safe_cast<Process::ControlInlet&>(*proc.inlets()[5]), std::move(images)});
   };
   vec.push_back(std::move(p));
   return;
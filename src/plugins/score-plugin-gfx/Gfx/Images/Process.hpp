@@ -16,6 +16,7 @@
 namespace Gfx
 {
 std::vector<score::gfx::Image> getImages(const ossia::value& val);
+std::vector<QString> getImagePaths(const ossia::value& val);
 ossia::value fromImageSet(const tcb::span<score::gfx::Image>& images);
 void releaseImages(std::vector<score::gfx::Image>& imgs);
 
@@ -54,6 +55,9 @@ public:
 
   ~Model() override;
 
+  //! True if the images do not fit in the cache and are decoded while playing
+  bool streaming() const noexcept { return m_streaming; }
+
   //std::vector<score::gfx::Image> images() const noexcept;
   //void setImages(const std::vector<score::gfx::Image>& f);
   //  void imagesChanged() W_SIGNAL(imagesChanged);
@@ -65,6 +69,7 @@ private:
   void on_imagesChanged(const ossia::value& v);
   QString prettyName() const noexcept override;
   std::vector<score::gfx::Image> m_currentImages;
+  bool m_streaming{};
 };
 
 using ProcessFactory = Process::ProcessFactory_T<Gfx::Images::Model>;
@@ -0,0 +1,153 @@
+#include "ReadbackRing.hpp"
+
+#include <Gfx/Graph/RenderList.hpp>
+
+#include <algorithm>
+
+namespace Gfx
+{
+
+int ReadbackRing::defaultDepth() noexcept
+{
+  bool ok{};
+  const int depth = qEnvironmentVariableIntValue("SCORE_GFX_READBACK_FRAMES", &ok);
+  return ok ? std::clamp(depth, 1, 16) : 3;
+}
+
+ReadbackRing::ReadbackRing(int depth, Consumer consumer, Overflow overflow)
+    : m_depth{std::max(depth, 1)}
+    , m_overflow{overflow}
+    , m_consumer{std::move(consumer)}
+{
+  m_thread = std::thread{[this] { run(); }};
+}
+
+ReadbackRing::~ReadbackRing()
+{
+  {
+    std::lock_guard lck{m_mutex};
+    m_stop = true;
+  }
+  m_cv.notify_one();
+  m_thread.join();
+}
+
+QRhiReadbackResult& ReadbackRing::request() noexcept
+{
+  m_requested = std::chrono::steady_clock::now();
+  return m_result;
+}
+
+void ReadbackRing::submit()
+{
+  if(m_result.data.isEmpty())
+    return;
+
+  {
+    std::unique_lock lck{m_mutex};
+    if(m_overflow == Overflow::Block)
+    {
+      m_consumedCv.wait(lck, [this] { return int(m_pending.size()) < m_depth; });
+    }
+
+    m_pending.push_back(
+        Frame{std::move(m_result.data), m_result.pixelSize, m_requested});
+    m_stats.submitted++;
+
+    // The consumer is too slow: keep the most recent frames
+    while(int(m_pending.size()) > m_depth)
+    {
+      m_free.push_back(std::move(m_pending.front().data));
+      m_pending.pop_front();
+      m_stats.dropped++;
+    }
+
+    // QRhi only reallocates the buffer if it does not have the right size
+    if(!m_free.empty())
+    {
+      m_result.data = std::move(m_free.back());
+      m_free.pop_back();
+    }
+  }
+  m_cv.notify_one();
+}
+
+void ReadbackRing::flush()
+{
+  std::unique_lock lck{m_mutex};
+  m_consumedCv.wait(lck, [this] { return m_pending.empty() && !m_consuming; });
+}
+
+ReadbackRing::Statistics ReadbackRing::statistics() const
+{
+  std::lock_guard lck{m_mutex};
+  auto stats = m_stats;
+  if(stats.consumed > 0)
+    stats.meanLatency = m_totalLatency / stats.consumed;
+  return stats;
+}
+
+void ReadbackRing::run()
+{
+  std::unique_lock lck{m_mutex};
+  for(;;)
+  {
+    m_cv.wait(lck, [this] { return m_stop || !m_pending.empty(); });
+
+    // The frames already read back are still given to the consumer
+    if(m_pending.empty())
+      return;
+
+    auto frame = std::move(m_pending.front());
+    m_pending.pop_front();
+    m_consuming = true;
+    m_consumedCv.notify_all();
+
+    lck.unlock();
+    m_consumer(frame);
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - frame.requested);
+    lck.lock();
+
+    m_consuming = false;
+    m_consumedCv.notify_all();
+    m_stats.consumed++;
+    m_totalLatency += latency;
+    m_free.push_back(std::move(frame.data));
+  }
+}
+
+ReadbackRenderer::ReadbackRenderer(
+    score::gfx::TextureRenderTarget rt, ReadbackRing& ring)
+    : score::gfx::OutputNodeRenderer{}
+    , m_inputTarget{std::move(rt)}
+    , m_ring{ring}
+{
+}
+
+void ReadbackRenderer::init(
+    score::gfx::RenderList& renderer, QRhiResourceUpdateBatch& res)
+{
+}
+
+void ReadbackRenderer::update(
+    score::gfx::RenderList& renderer, QRhiResourceUpdateBatch& res)
+{
+}
+
+void ReadbackRenderer::release(score::gfx::RenderList&) { }
+
+void ReadbackRenderer::finishFrame(
+    score::gfx::RenderList& renderer, QRhiCommandBuffer& cb,
+    QRhiResourceUpdateBatch*& res)
+{
+  if(!res)
+    res = renderer.state.rhi->nextResourceUpdateBatch();
+
+  QRhiReadbackDescription rb(m_inputTarget.texture);
+  res->readBackTexture(rb, &m_ring.request());
+  cb.resourceUpdate(res);
+  res = nullptr;
+}
+
+}
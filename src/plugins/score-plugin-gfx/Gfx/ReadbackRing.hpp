@@ -0,0 +1,132 @@
+#pragma once
+
+#include <Gfx/Graph/NodeRenderer.hpp>
+#include <Gfx/Graph/OutputNode.hpp>
+
+#include <QByteArray>
+#include <QSize>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Gfx
+{
+/**
+ * @brief Hands the frames read back from the GPU to a CPU consumer thread
+ *
+ * The render thread only records the readback and moves the resulting buffer
+ * to the ring: the consumer (copy to shared memory, analysis, previews...)
+ * runs on its own thread. At most depth frames are waiting for the consumer:
+ * beyond that, either the oldest frames are dropped, which bounds the latency
+ * added by the ring, or the render thread waits for the consumer, e.g.
+ * when exporting to a file where every frame matters.
+ *
+ * The buffers are recycled once consumed so that no allocation happens
+ * in steady state.
+ */
+class SCORE_PLUGIN_GFX_EXPORT ReadbackRing
+{
+public:
+  struct Frame
+  {
+    QByteArray data;
+    QSize size;
+    std::chrono::steady_clock::time_point requested;
+  };
+
+  struct Statistics
+  {
+    int64_t submitted{};
+    int64_t consumed{};
+    int64_t dropped{};
+    std::chrono::microseconds meanLatency{};
+  };
+
+  using Consumer = std::function<void(const Frame&)>;
+
+  enum class Overflow
+  {
+    DropOldest,
+    Block
+  };
+
+  //! Depth of the rings if not given by the SCORE_GFX_READBACK_FRAMES variable
+  static int defaultDepth() noexcept;
+
+  ReadbackRing(int depth, Consumer consumer, Overflow overflow = Overflow::DropOldest);
+  ~ReadbackRing();
+
+  ReadbackRing(const ReadbackRing&) = delete;
+  ReadbackRing& operator=(const ReadbackRing&) = delete;
+
+  //! Called by the renderer when recording the readback of a frame
+  QRhiReadbackResult& request() noexcept;
+
+  //! Called once the frame containing the readback has been submitted
+  void submit();
+
+  //! Waits until the consumer has processed every submitted frame
+  void flush();
+
+  Statistics statistics() const;
+
+private:
+  void run();
+
+  const int m_depth{};
+  const Overflow m_overflow{};
+  Consumer m_consumer;
+
+  QRhiReadbackResult m_result;
+  std::chrono::steady_clock::time_point m_requested{};
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::condition_variable m_consumedCv;
+  std::deque<Frame> m_pending;
+  std::vector<QByteArray> m_free;
+  Statistics m_stats;
+  std::chrono::microseconds m_totalLatency{};
+  bool m_consuming{};
+  bool m_stop{};
+
+  std::thread m_thread;
+};
+
+/**
+ * @brief Output renderer reading back the texture its inputs render to
+ *
+ * Unlike InvertYRenderer there is no additional pass: flipping the image
+ * if needed is left to the consumer of the ring, which does it while copying.
+ */
+class SCORE_PLUGIN_GFX_EXPORT ReadbackRenderer final
+    : public score::gfx::OutputNodeRenderer
+{
+public:
+  ReadbackRenderer(score::gfx::TextureRenderTarget rt, ReadbackRing& ring);
+
+  score::gfx::TextureRenderTarget
+  renderTargetForInput(const score::gfx::Port& p) override
+  {
+    return m_inputTarget;
+  }
+
+  void finishFrame(
+      score::gfx::RenderList& renderer, QRhiCommandBuffer& cb,
+      QRhiResourceUpdateBatch*& res) override;
+
+  void init(score::gfx::RenderList& renderer, QRhiResourceUpdateBatch& res) override;
+  void update(score::gfx::RenderList& renderer, QRhiResourceUpdateBatch& res) override;
+  void release(score::gfx::RenderList&) override;
+
+private:
+  score::gfx::TextureRenderTarget m_inputTarget;
+  ReadbackRing& m_ring;
+};
+
+}
@@ -40,11 +40,15 @@ SETTINGS_PARAMETER_IMPL(Rate){QStringLiteral("score_plugin_gfx/Rate"), 60.0};
 SETTINGS_PARAMETER_IMPL(Samples){QStringLiteral("score_plugin_gfx/Samples"), 1};
 SETTINGS_PARAMETER_IMPL(DecodingThreads){
     QStringLiteral("score_plugin_gfx/DecodingThreads"), 2};
+SETTINGS_PARAMETER_IMPL(ImageCacheSize){
+    QStringLiteral("score_plugin_gfx/ImageCacheSize"), 1024};
 SETTINGS_PARAMETER_IMPL(VSync){QStringLiteral("score_plugin_gfx/VSync"), true};
 
 static auto list()
 {
-  return std::tie(GraphicsApi, HardwareDecode, DecodingThreads, Samples, Rate, VSync);
+  return std::tie(
+      GraphicsApi, HardwareDecode, DecodingThreads, ImageCacheSize, Samples, Rate,
+      VSync);
 }
 }
 
@@ -137,6 +141,7 @@ SCORE_SETTINGS_PARAMETER_CPP(QString, Model, HardwareDecode)
 SCORE_SETTINGS_PARAMETER_CPP(double, Model, Rate)
 SCORE_SETTINGS_PARAMETER_CPP(int, Model, Samples)
 SCORE_SETTINGS_PARAMETER_CPP(int, Model, DecodingThreads)
+SCORE_SETTINGS_PARAMETER_CPP(int, Model, ImageCacheSize)
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, VSync)
 
 }
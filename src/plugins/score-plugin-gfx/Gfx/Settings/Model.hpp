@@ -40,6 +40,7 @@ class Model : public score::SettingsDelegateModel
   QString m_GraphicsApi{};
   QString m_HardwareDecode{};
   int m_DecodingThreads{1};
+  int m_ImageCacheSize{};
   double m_Rate{};
   int m_Samples{1};
   bool m_VSync{};
@@ -49,6 +50,7 @@ public:
 
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_GFX_EXPORT, QString, HardwareDecode)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_GFX_EXPORT, int, DecodingThreads)
+  SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_GFX_EXPORT, int, ImageCacheSize)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_GFX_EXPORT, double, Rate)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_GFX_EXPORT, int, Samples)
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_GFX_EXPORT, bool, VSync)
@@ -66,6 +68,7 @@ public:
 SCORE_SETTINGS_PARAMETER(Model, GraphicsApi)
 SCORE_SETTINGS_PARAMETER(Model, HardwareDecode)
 SCORE_SETTINGS_PARAMETER(Model, DecodingThreads)
+SCORE_SETTINGS_PARAMETER(Model, ImageCacheSize)
 SCORE_SETTINGS_PARAMETER(Model, Rate)
 SCORE_SETTINGS_PARAMETER(Model, Samples)
 SCORE_SETTINGS_PARAMETER(Model, VSync)
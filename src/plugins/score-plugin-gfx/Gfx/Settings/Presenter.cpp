@@ -22,6 +22,7 @@ Presenter::Presenter(Model& m, View& v, QObject* parent)
   SETTINGS_PRESENTER(HardwareDecode);
   SETTINGS_PRESENTER(Samples);
   SETTINGS_PRESENTER(DecodingThreads);
+  SETTINGS_PRESENTER(ImageCacheSize);
   SETTINGS_PRESENTER(Rate);
   SETTINGS_PRESENTER(VSync);
 }
@@ -29,6 +29,10 @@ View::View()
 
   static constexpr int t_values[]{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
   SETTINGS_UI_NUM_COMBOBOX_SETUP("Decoding threads", DecodingThreads, t_values);
+  SETTINGS_UI_SPINBOX_SETUP("Image streaming cache (MB)", ImageCacheSize);
+  m_ImageCacheSize->setRange(16, 65536);
+  m_ImageCacheSize->setToolTip(
+      tr("Image sequences which do not fit in this budget are streamed from disk"));
 
   static constexpr int aa_values[]{1, 2, 4, 8, 16};
   SETTINGS_UI_NUM_COMBOBOX_SETUP("Multisampling AA", Samples, aa_values);
@@ -45,6 +49,7 @@ QWidget* View::getWidget()
 SETTINGS_UI_COMBOBOX_IMPL(GraphicsApi)
 SETTINGS_UI_COMBOBOX_IMPL(HardwareDecode)
 SETTINGS_UI_NUM_COMBOBOX_IMPL(DecodingThreads)
+SETTINGS_UI_SPINBOX_IMPL(ImageCacheSize)
 SETTINGS_UI_NUM_COMBOBOX_IMPL(Samples)
 SETTINGS_UI_DOUBLE_SPINBOX_IMPL(Rate)
 SETTINGS_UI_TOGGLE_IMPL(VSync)
@@ -18,6 +18,7 @@ public:
   SETTINGS_UI_COMBOBOX_HPP(GraphicsApi)
   SETTINGS_UI_COMBOBOX_HPP(HardwareDecode)
   SETTINGS_UI_NUM_COMBOBOX_HPP(DecodingThreads)
+  SETTINGS_UI_SPINBOX_HPP(ImageCacheSize)
   SETTINGS_UI_DOUBLE_SPINBOX_HPP(Rate)
   SETTINGS_UI_NUM_COMBOBOX_HPP(Samples)
   SETTINGS_UI_TOGGLE_HPP(VSync)
@@ -36,6 +36,7 @@
 #include <shmdata/console-logger.hpp>
 extern "C" {
 #include <libavformat/avformat.h>
+#include <libavutil/buffer.h>
 }
 
 namespace Gfx::Shmdata
@@ -106,13 +107,67 @@ public:
 
     // Remove frames that were in flight
     m_frames.drain();
+
+#if !defined(SCORE_DEPLOYMENT_BUILD)
+    if(m_copiedFrames > 0 && qEnvironmentVariableIsSet("SCORE_GFX_STATISTICS"))
+    {
+      qDebug() << "Shmdata input:" << m_copiedFrames << "frames copied,"
+               << m_copiedBytes / m_copiedFrames << "bytes per frame," << m_dropped
+               << "dropped";
+    }
+#endif
+    m_copiedFrames = 0;
+    m_copiedBytes = 0;
+    m_dropped = 0;
+
+    // The frames still held by the renderer keep it alive until released
+    av_buffer_pool_uninit(&m_pool);
+    m_poolBufferSize = 0;
   }
 
-  AVFrame* dequeue_frame() noexcept override { return m_frames.dequeue(); }
+  AVFrame* dequeue_frame() noexcept override
+  {
+    // Only the latest frame is shown: the buffers of the others
+    // go back to the pool right away
+    AVFrame* frame = m_frames.dequeue_one();
+    while(AVFrame* next = m_frames.dequeue_one())
+    {
+      release_frame(frame);
+      frame = next;
+    }
+    return frame;
+  }
 
-  void release_frame(AVFrame* frame) noexcept override { m_frames.release(frame); }
+  void release_frame(AVFrame* frame) noexcept override
+  {
+    if(frame)
+    {
+      av_frame_unref(frame);
+      m_frames.release(frame);
+    }
+  }
 
 private:
+  void resetPool(std::size_t sz)
+  {
+    av_buffer_pool_uninit(&m_pool);
+
+    // Triple buffering: one frame shown, one waiting for the renderer
+    // and one being copied. The pool is freed along with its last buffer.
+    auto count = new int{};
+    m_pool = av_buffer_pool_init2(
+        sz, count,
+        [](void* opaque, auto size) -> AVBufferRef* {
+      auto& count = *static_cast<int*>(opaque);
+      if(count >= 3)
+        return nullptr;
+      count++;
+      return av_buffer_alloc(size);
+        },
+        [](void* opaque) { delete static_cast<int*>(opaque); });
+    m_poolBufferSize = sz;
+  }
+
   void setup(const std::string& str)
   {
     // "video/x-raw, format=(string)AYUV64, width=(int)320, height=(int)240, framerate=(fraction)30/1, multiview-mode=(string)mono, pixel-aspect-ratio=(fraction)1/1, interlace-mode=(string)progressive";
@@ -230,18 +285,31 @@ private:
     }
     else
     {
+      // Gives back the buffer of a frame released by the renderer
       ::Video::AVFramePointer frame = m_frames.newFrame();
 
+      if(sz != m_poolBufferSize)
+        resetPool(sz);
+
+      // The renderer is late: all the buffers are in use
+      AVBufferRef* buf = av_buffer_pool_get(m_pool);
+      if(!buf)
+      {
+        m_dropped++;
+        return;
+      }
+
       frame->format = this->pixel_format;
       frame->width = this->width;
       frame->height = this->height;
+      frame->buf[0] = buf;
+      ::Video::initFrameFromRawData(frame.get(), buf->data, sz);
 
-      // Here we need to copy the buffer.
-      const auto storage = ::Video::initFrameBuffer(*frame, sz);
-      ::Video::initFrameFromRawData(frame.get(), storage, sz);
-
-      // Copy the content as we're going on *adventures*
-      memcpy(storage, p, sz);
+      // The shm segment is only readable during this callback: this is the
+      // only copy before the upload, which reads the pooled buffer directly.
+      memcpy(buf->data, p, sz);
+      m_copiedBytes += sz;
+      m_copiedFrames++;
 
       m_frames.enqueue(frame.release());
     }
@@ -250,6 +318,12 @@ private:
   ::Video::FrameQueue m_frames;
   ::Video::Rescale m_rescale;
 
+  AVBufferPool* m_pool{};
+  std::size_t m_poolBufferSize{};
+  int64_t m_copiedFrames{};
+  int64_t m_copiedBytes{};
+  int64_t m_dropped{};
+
   std::atomic_bool m_running{};
 
   std::string m_path;
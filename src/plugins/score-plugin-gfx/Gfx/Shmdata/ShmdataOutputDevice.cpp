@@ -6,7 +6,7 @@
 #include <Gfx/Graph/NodeRenderer.hpp>
 #include <Gfx/Graph/OutputNode.hpp>
 #include <Gfx/Graph/RenderList.hpp>
-#include <Gfx/InvertYRenderer.hpp>
+#include <Gfx/ReadbackRing.hpp>
 
 #include <score/gfx/OpenGL.hpp>
 
@@ -14,6 +14,7 @@
 #include <ossia/network/base/device.hpp>
 #include <ossia/network/base/protocol.hpp>
 
+#include <QDebug>
 #include <QFormLayout>
 #include <QLabel>
 #include <QLineEdit>
@@ -96,7 +97,7 @@ struct ShmdataOutputNode : score::gfx::OutputNode
 
   SharedOutputSettings m_settings;
 
-  QRhiReadbackResult m_readback;
+  std::unique_ptr<ReadbackRing> m_readbacks;
   shmdata::ConsoleLogger m_logger;
 };
 
@@ -152,10 +153,8 @@ void ShmdataOutputNode::render()
     renderer->render(*cb);
     rhi->endOffscreenFrame();
 
-    int sz = m_readback.pixelSize.width() * m_readback.pixelSize.height() * 4;
-    int bytes = m_readback.data.size();
-    if(bytes > 0 && bytes >= sz)
-      m_writer->copy_to_shm(m_readback.data.data(), sz);
+    // The copy to shared memory happens on the thread of the ring
+    m_readbacks->submit();
   }
 }
 
@@ -213,11 +212,43 @@ void ShmdataOutputNode::createOutput(
   m_renderTarget->setRenderPassDescriptor(m_renderState->renderPassDescriptor);
   m_renderTarget->create();
 
+  // The rows are always written in reverse order, as the InvertYRenderer
+  // used before did: the clients expect this orientation
+  const int64_t allocated = int64_t(m_settings.width) * m_settings.height * 4;
+  m_readbacks = std::make_unique<ReadbackRing>(
+      ReadbackRing::defaultDepth(),
+      [writer = m_writer, allocated](const ReadbackRing::Frame& frame) {
+    const int stride = frame.size.width() * 4;
+    const int rows = frame.size.height();
+    const int64_t sz = int64_t(stride) * rows;
+    if(frame.data.size() < sz || sz > allocated)
+      return;
+
+    auto access = writer->get_one_write_access();
+    auto dst = static_cast<char*>(access->get_mem());
+    const char* src = frame.data.constData();
+    for(int i = 0; i < rows; i++)
+      std::copy_n(src + (rows - 1 - i) * stride, stride, dst + i * stride);
+    access->notify_clients(sz);
+  });
+
   onReady();
 }
 
 void ShmdataOutputNode::destroyOutput()
 {
+#if !defined(SCORE_DEPLOYMENT_BUILD)
+  if(m_readbacks && qEnvironmentVariableIsSet("SCORE_GFX_STATISTICS"))
+  {
+    const auto stats = m_readbacks->statistics();
+    qDebug() << "Shmdata readbacks:" << stats.submitted << "submitted,"
+             << stats.consumed << "consumed," << stats.dropped << "dropped,"
+             << stats.meanLatency.count() << "us mean latency";
+  }
+#endif
+
+  // Waits for the last frame being copied
+  m_readbacks.reset();
   m_writer.reset();
 }
 
@@ -231,7 +262,7 @@ ShmdataOutputNode::createRenderer(score::gfx::RenderList& r) const noexcept
 {
   score::gfx::TextureRenderTarget rt{
       m_texture, nullptr, nullptr, m_renderState->renderPassDescriptor, m_renderTarget};
-  return new Gfx::InvertYRenderer{rt, const_cast<QRhiReadbackResult&>(m_readback)};
+  return new Gfx::ReadbackRenderer{rt, *m_readbacks};
 }
 
 ShmdataOutputDevice::~ShmdataOutputDevice() { }
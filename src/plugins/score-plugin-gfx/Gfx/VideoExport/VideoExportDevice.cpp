@@ -0,0 +1,356 @@
+#include "VideoExportDevice.hpp"
+
+#include <Gfx/GfxApplicationPlugin.hpp>
+#include <Gfx/GfxExecContext.hpp>
+#include <Gfx/GfxParameter.hpp>
+#include <Gfx/Graph/NodeRenderer.hpp>
+#include <Gfx/Graph/OutputNode.hpp>
+#include <Gfx/Graph/RenderList.hpp>
+#include <Gfx/ReadbackRing.hpp>
+#include <Video/VideoEncoder.hpp>
+
+#include <score/gfx/OpenGL.hpp>
+
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/protocol.hpp>
+
+#include <QDebug>
+#include <QFormLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QOffscreenSurface>
+
+#if __has_include(<QtGui/rhi/qrhi_platform.h>)
+#include <QtGui/rhi/qrhi_platform.h>
+#else
+#include <QtGui/private/qrhigles2_p_p.h>
+#endif
+
+#include <wobjectimpl.h>
+
+namespace Gfx
+{
+class VideoExportDevice final : public GfxOutputDevice
+{
+  W_OBJECT(VideoExportDevice)
+public:
+  using GfxOutputDevice::GfxOutputDevice;
+  ~VideoExportDevice();
+
+private:
+  bool reconnect() override;
+  ossia::net::device_base* getDevice() const override { return m_dev.get(); }
+
+  gfx_protocol_base* m_protocol{};
+  mutable std::unique_ptr<ossia::net::device_base> m_dev;
+};
+
+class VideoExportSettingsWidget final : public Gfx::SharedOutputSettingsWidget
+{
+public:
+  VideoExportSettingsWidget(QWidget* parent = nullptr);
+
+  Device::DeviceSettings getSettings() const override;
+};
+
+}
+W_OBJECT_IMPL(Gfx::VideoExportDevice)
+
+namespace Gfx
+{
+struct VideoExportNode : score::gfx::OutputNode
+{
+  explicit VideoExportNode(const SharedOutputSettings&);
+  virtual ~VideoExportNode();
+
+  std::weak_ptr<score::gfx::RenderList> m_renderer{};
+  QRhiTexture* m_texture{};
+  QRhiTextureRenderTarget* m_renderTarget{};
+  std::function<void()> m_update;
+  std::shared_ptr<score::gfx::RenderState> m_renderState{};
+  std::shared_ptr<Video::VideoEncoder> m_encoder{};
+
+  void startRendering() override;
+  void onRendererChange() override;
+  void render() override;
+  bool canRender() const override;
+  void stopRendering() override;
+  void startOfflineRendering() override;
+  void stopOfflineRendering() override;
+
+  void setRenderer(std::shared_ptr<score::gfx::RenderList> r) override;
+  score::gfx::RenderList* renderer() const override;
+
+  void createOutput(
+      score::gfx::GraphicsApi graphicsApi, std::function<void()> onReady,
+      std::function<void()> onUpdate, std::function<void()> onResize) override;
+  void destroyOutput() override;
+
+  std::shared_ptr<score::gfx::RenderState> renderState() const override;
+  score::gfx::OutputNodeRenderer*
+  createRenderer(score::gfx::RenderList& r) const noexcept override;
+  Configuration configuration() const noexcept override;
+
+  SharedOutputSettings m_settings;
+
+  std::unique_ptr<ReadbackRing> m_readbacks;
+};
+
+class video_export_device : public ossia::net::device_base
+{
+  gfx_node_base root;
+
+public:
+  video_export_device(
+      const SharedOutputSettings& set, std::unique_ptr<ossia::net::protocol_base> proto,
+      std::string name)
+      : ossia::net::device_base{std::move(proto)}
+      , root{*this, new VideoExportNode{set}, name}
+  {
+  }
+
+  const gfx_node_base& get_root_node() const override { return root; }
+  gfx_node_base& get_root_node() override { return root; }
+};
+}
+
+namespace Gfx
+{
+
+VideoExportNode::VideoExportNode(const SharedOutputSettings& set)
+    : OutputNode{}
+    , m_encoder{std::make_shared<Video::VideoEncoder>()}
+    , m_settings{set}
+{
+  input.push_back(new score::gfx::Port{this, {}, score::gfx::Types::Image, {}});
+}
+
+VideoExportNode::~VideoExportNode()
+{
+  m_readbacks.reset();
+  if(m_encoder->isOpen())
+    m_encoder->close();
+}
+
+bool VideoExportNode::canRender() const
+{
+  return m_encoder->isOpen();
+}
+
+void VideoExportNode::startRendering() { }
+
+void VideoExportNode::render()
+{
+  if(m_update)
+    m_update();
+
+  auto renderer = m_renderer.lock();
+  if(renderer && m_renderState && canRender())
+  {
+    auto rhi = m_renderState->rhi;
+    QRhiCommandBuffer* cb{};
+    if(rhi->beginOffscreenFrame(&cb) != QRhi::FrameOpSuccess)
+      return;
+
+    renderer->render(*cb);
+    rhi->endOffscreenFrame();
+
+    // Waits if the encoder is late, so that no frame is ever dropped
+    m_readbacks->submit();
+  }
+}
+
+score::gfx::OutputNode::Configuration VideoExportNode::configuration() const noexcept
+{
+  return {.manualRenderingRate = 1000. / m_settings.rate, .offline = true};
+}
+
+void VideoExportNode::onRendererChange() { }
+
+void VideoExportNode::stopRendering() { }
+
+void VideoExportNode::startOfflineRendering()
+{
+  // The file is kept open while the graph is recreated
+  if(m_encoder->isOpen())
+    return;
+
+  if(!m_encoder->open(
+         m_settings.path.toStdString(), m_settings.width, m_settings.height,
+         m_settings.rate))
+    qDebug() << "Video export: could not open" << m_settings.path;
+}
+
+void VideoExportNode::stopOfflineRendering()
+{
+  if(!m_encoder->isOpen())
+    return;
+
+  // Encodes the frames still in the ring before finishing the file
+  if(m_readbacks)
+    m_readbacks->flush();
+
+  qDebug() << "Video export:" << m_encoder->frames() << "frames written to"
+           << m_settings.path;
+  m_encoder->close();
+}
+
+void VideoExportNode::setRenderer(std::shared_ptr<score::gfx::RenderList> r)
+{
+  m_renderer = r;
+}
+
+score::gfx::RenderList* VideoExportNode::renderer() const
+{
+  return m_renderer.lock().get();
+}
+
+void VideoExportNode::createOutput(
+    score::gfx::GraphicsApi graphicsApi, std::function<void()> onReady,
+    std::function<void()> onUpdate, std::function<void()> onResize)
+{
+  m_renderState = std::make_shared<score::gfx::RenderState>();
+  m_update = onUpdate;
+
+  m_renderState->surface = QRhiGles2InitParams::newFallbackSurface();
+  QRhiGles2InitParams params;
+  params.fallbackSurface = m_renderState->surface;
+  score::GLCapabilities caps;
+  caps.setupFormat(params.format);
+  m_renderState->rhi = QRhi::create(QRhi::OpenGLES2, &params, {});
+  m_renderState->renderSize = QSize(m_settings.width, m_settings.height);
+  m_renderState->outputSize = m_renderState->renderSize;
+  m_renderState->api = score::gfx::GraphicsApi::OpenGL;
+  m_renderState->version = caps.qShaderVersion;
+
+  auto rhi = m_renderState->rhi;
+  m_texture = rhi->newTexture(
+      QRhiTexture::RGBA8, m_renderState->renderSize, 1,
+      QRhiTexture::RenderTarget | QRhiTexture::UsedAsTransferSource);
+  m_texture->create();
+  m_renderTarget = rhi->newTextureRenderTarget({m_texture});
+  m_renderState->renderPassDescriptor
+      = m_renderTarget->newCompatibleRenderPassDescriptor();
+  m_renderTarget->setRenderPassDescriptor(m_renderState->renderPassDescriptor);
+  m_renderTarget->create();
+
+  // The encoding happens on the thread of the ring, while the next frames render
+  const bool flip = rhi->isYUpInFramebuffer();
+  auto encode = [encoder = m_encoder, flip](const ReadbackRing::Frame& frame) {
+    const int stride = frame.size.width() * 4;
+    if(frame.data.size() >= int64_t(stride) * frame.size.height())
+      encoder->addFrame(
+          reinterpret_cast<const uint8_t*>(frame.data.constData()), stride, flip);
+  };
+  m_readbacks = std::make_unique<ReadbackRing>(
+      ReadbackRing::defaultDepth(), std::move(encode), ReadbackRing::Overflow::Block);
+
+  onReady();
+}
+
+void VideoExportNode::destroyOutput()
+{
+  // The frames still in the ring are encoded: the file stays open
+  // until the offline clock stops
+  m_readbacks.reset();
+}
+
+std::shared_ptr<score::gfx::RenderState> VideoExportNode::renderState() const
+{
+  return m_renderState;
+}
+
+score::gfx::OutputNodeRenderer*
+VideoExportNode::createRenderer(score::gfx::RenderList& r) const noexcept
+{
+  score::gfx::TextureRenderTarget rt{
+      m_texture, nullptr, nullptr, m_renderState->renderPassDescriptor, m_renderTarget};
+  return new Gfx::ReadbackRenderer{rt, *m_readbacks};
+}
+
+VideoExportDevice::~VideoExportDevice() { }
+
+bool VideoExportDevice::reconnect()
+{
+  disconnect();
+
+  try
+  {
+    auto plug = m_ctx.findPlugin<DocumentPlugin>();
+    if(plug)
+    {
+      auto set = m_settings.deviceSpecificSettings.value<SharedOutputSettings>();
+      m_protocol = new gfx_protocol_base{plug->exec};
+      m_dev = std::make_unique<video_export_device>(
+          set, std::unique_ptr<ossia::net::protocol_base>(m_protocol),
+          m_settings.name.toStdString());
+    }
+  }
+  catch(std::exception& e)
+  {
+    qDebug() << "Could not connect: " << e.what();
+  }
+  catch(...)
+  {
+  }
+
+  return connected();
+}
+
+Device::ProtocolSettingsWidget* VideoExportProtocolFactory::makeSettingsWidget()
+{
+  return new VideoExportSettingsWidget{};
+}
+
+QString VideoExportProtocolFactory::prettyName() const noexcept
+{
+  return QObject::tr("Video Export");
+}
+
+Device::DeviceInterface* VideoExportProtocolFactory::makeDevice(
+    const Device::DeviceSettings& settings, const Explorer::DeviceDocumentPlugin& doc,
+    const score::DocumentContext& ctx)
+{
+  return new VideoExportDevice(settings, ctx);
+}
+
+const Device::DeviceSettings& VideoExportProtocolFactory::defaultSettings() const noexcept
+{
+  static const Device::DeviceSettings settings = [&]() {
+    Device::DeviceSettings s;
+    s.protocol = concreteKey();
+    s.name = "Video Export";
+    SharedOutputSettings set;
+    set.width = 1280;
+    set.height = 720;
+    set.path = "/tmp/score_export.mkv";
+    set.rate = 60.;
+    s.deviceSpecificSettings = QVariant::fromValue(set);
+    return s;
+  }();
+  return settings;
+}
+
+VideoExportSettingsWidget::VideoExportSettingsWidget(QWidget* parent)
+    : SharedOutputSettingsWidget{parent}
+{
+  m_deviceNameEdit->setText("Video Export");
+  ((QLabel*)m_layout->labelForField(m_shmPath))->setText("File");
+
+  auto helpLabel = new QLabel{
+      tr("The format is chosen from the file extension.\n"
+         "The export happens when playing with the offline clock\n"
+         "of the execution settings.")};
+  m_layout->addRow(helpLabel);
+
+  setSettings(VideoExportProtocolFactory{}.defaultSettings());
+}
+
+Device::DeviceSettings VideoExportSettingsWidget::getSettings() const
+{
+  auto set = SharedOutputSettingsWidget::getSettings();
+  set.protocol = VideoExportProtocolFactory::static_concreteKey();
+  return set;
+}
+
+}
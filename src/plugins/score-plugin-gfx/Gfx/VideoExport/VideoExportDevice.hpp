@@ -0,0 +1,35 @@
+#pragma once
+#include <Device/Protocol/DeviceInterface.hpp>
+#include <Device/Protocol/DeviceSettings.hpp>
+#include <Device/Protocol/ProtocolFactoryInterface.hpp>
+#include <Device/Protocol/ProtocolSettingsWidget.hpp>
+
+#include <Gfx/GfxDevice.hpp>
+#include <Gfx/SharedOutputSettings.hpp>
+
+namespace Gfx
+{
+
+/**
+ * @brief Renders its input to a video file
+ *
+ * The file is written while the offline clock plays: the frames are
+ * rendered in lockstep with the execution, at the rate given in the settings
+ * counted in execution time, thus the export runs as fast as the rendering
+ * and the encoding allow and the result does not depend on the wall clock.
+ */
+class VideoExportProtocolFactory final : public Gfx::SharedOutputProtocolFactory
+{
+  SCORE_CONCRETE("1b2ba1d4-42b3-4e0f-a3ab-2d8a24b9c7b6")
+public:
+  QString prettyName() const noexcept override;
+
+  Device::DeviceInterface* makeDevice(
+      const Device::DeviceSettings& settings, const Explorer::DeviceDocumentPlugin& doc,
+      const score::DocumentContext& ctx) override;
+  const Device::DeviceSettings& defaultSettings() const noexcept override;
+
+  Device::ProtocolSettingsWidget* makeSettingsWidget() override;
+};
+
+}
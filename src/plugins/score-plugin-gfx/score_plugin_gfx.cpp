@@ -30,6 +30,9 @@
 #include <Gfx/Shmdata/ShmdataInputDevice.hpp>
 #include <Gfx/Shmdata/ShmdataOutputDevice.hpp>
 #endif
+#if defined(SCORE_HAS_VIDEO_EXPORT)
+#include <Gfx/VideoExport/VideoExportDevice.hpp>
+#endif
 #if defined(HAS_SPOUT)
 #include <Gfx/Spout/SpoutInput.hpp>
 #include <Gfx/Spout/SpoutOutput.hpp>
@@ -68,6 +71,10 @@ std::vector<score::InterfaceBase*> score_plugin_gfx::factories(
          ,
          Gfx::Shmdata::InputFactory, Gfx::ShmdataOutputProtocolFactory
 #endif
+#if defined(SCORE_HAS_VIDEO_EXPORT)
+         ,
+         Gfx::VideoExportProtocolFactory
+#endif
 #if defined(HAS_SPOUT)
          ,
          Gfx::Spout::InputFactory, Gfx::SpoutProtocolFactory
@@ -104,8 +104,6 @@ class LibraryHandler final
 
   QSet<QString> acceptedFiles() const noexcept override { return {"qml"}; }
 
-  static inline const QRegularExpression scoreImport{"import Score [0-9].[0-9]"};
-
   Library::Subcategories categories;
 
   void setup(Library::ProcessesItemModel& model, const score::GUIApplicationContext& ctx)
@@ -122,6 +120,16 @@ class LibraryHandler final
 
   void addPath(std::string_view path) override
   {
+    if(auto add = preparePath(path))
+      add();
+  }
+
+  std::function<void()> preparePath(std::string_view path) override
+  {
+    // The file is read and matched on the worker threads,
+    // which each have their own expression
+    thread_local const QRegularExpression scoreImport{"import Score [0-9].[0-9]"};
+
     QFileInfo file{QString::fromUtf8(path.data(), path.length())};
     Library::ProcessData pdata;
     pdata.prettyName = file.completeBaseName();
@@ -132,13 +140,12 @@ class LibraryHandler final
       return f.readAll().trimmed();
     }();
 
-    {
-      auto matches = scoreImport.match(pdata.customData);
-      if(matches.hasMatch())
-      {
-        categories.add(file, std::move(pdata));
-      }
-    }
+    if(!scoreImport.match(pdata.customData).hasMatch())
+      return {};
+
+    return [this, file = std::move(file), pdata = std::move(pdata)]() mutable {
+      categories.add(file, std::move(pdata));
+    };
   }
 };
 
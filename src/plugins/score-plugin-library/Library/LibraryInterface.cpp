@@ -22,6 +22,23 @@ void LibraryInterface::addPath(std::string_view) { }
 
 void LibraryInterface::removePath(std::string_view) { }
 
+std::function<void()> LibraryInterface::preparePath(std::string_view path)
+{
+  return [this, p = std::string(path)] { addPath(p); };
+}
+
+bool LibraryInterface::cachesMetadata() const noexcept
+{
+  return false;
+}
+
+QByteArray LibraryInterface::readMetadata(std::string_view)
+{
+  return {};
+}
+
+void LibraryInterface::addMetadata(std::string_view, const QByteArray&) { }
+
 QSet<QString> LibraryInterface::acceptedFiles() const noexcept
 {
   return {};
@@ -6,6 +6,8 @@
 #include <score/tools/std/StringHash.hpp>
 
 #include <score_plugin_library_export.h>
+
+#include <functional>
 class QAbstractItemModel;
 class QMimeData;
 class QDir;
@@ -34,6 +36,27 @@ public:
   virtual void setup(ProcessesItemModel& model, const score::GUIApplicationContext& ctx);
   virtual void addPath(std::string_view);
   virtual void removePath(std::string_view);
+
+  /**
+   * @brief Thread-safe part of addPath, called from worker threads.
+   *
+   * Reads what is needed from the file and returns what has to be done
+   * on the main thread. By default, addPath is called on the main thread.
+   */
+  virtual std::function<void()> preparePath(std::string_view);
+
+  /**
+   * @brief Cacheable part of addPath, called from worker threads.
+   *
+   * Returns what the handler needs to know about the file, or an empty array
+   * if the file is not handled. The result is kept in the library index with
+   * the modification date of the file, and given to addMetadata on the main
+   * thread: the files which did not change are not read again.
+   * Only used when cachesMetadata returns true.
+   */
+  virtual bool cachesMetadata() const noexcept;
+  virtual QByteArray readMetadata(std::string_view);
+  virtual void addMetadata(std::string_view, const QByteArray&);
   virtual bool onDrop(const QMimeData& mime, int row, int column, const QDir& parent);
 
   virtual bool onDoubleClick(const QString& path, const score::DocumentContext& ctx);
@@ -252,15 +252,22 @@ void PresetLibraryHandler::setup(
 
 void PresetLibraryHandler::addPath(std::string_view path)
 {
-  QFile f{QString::fromUtf8(path.data(), path.length())};
+  if(auto add = preparePath(path))
+    add();
+}
 
+std::function<void()> PresetLibraryHandler::preparePath(std::string_view path)
+{
+  // The parsing happens on the worker thread
+  QFile f{QString::fromUtf8(path.data(), path.length())};
   if(!f.open(QIODevice::ReadOnly))
-    return;
+    return {};
 
-  if(auto p = Process::Preset::fromJson(*processes, score::mapAsByteArray(f)))
-  {
-    presetLib->addPreset(std::move(*p));
-  }
+  auto p = Process::Preset::fromJson(*processes, score::mapAsByteArray(f));
+  if(!p)
+    return {};
+
+  return [this, p = std::move(p)]() mutable { presetLib->addPreset(std::move(*p)); };
 }
 
 bool PresetLibraryHandler::onDrop(
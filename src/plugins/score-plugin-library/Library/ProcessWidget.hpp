@@ -38,6 +38,7 @@ public:
       override;
 
   void addPath(std::string_view path) override;
+  std::function<void()> preparePath(std::string_view path) override;
 
   bool onDrop(const QMimeData& mime, int row, int column, const QDir& parent) override;
 
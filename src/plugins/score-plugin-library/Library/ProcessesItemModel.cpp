@@ -10,9 +10,11 @@
 #include <score/application/GUIApplicationContext.hpp>
 #include <score/tools/RecursiveWatch.hpp>
 
+#include <QDataStream>
 #include <QElapsedTimer>
 #include <QIcon>
 #include <QMimeData>
+#include <QStandardPaths>
 #include <QTimer>
 
 namespace Library
@@ -108,6 +110,17 @@ void ProcessesItemModel::rescan()
     score::RecursiveWatch::Callbacks cbs;
     cbs.added = [&lib](std::string_view path) { lib.addPath(path); };
     cbs.removed = [&lib](std::string_view path) { lib.removePath(path); };
+    cbs.prepare = [&lib](std::string_view path) { return lib.preparePath(path); };
+    if(lib.cachesMetadata())
+    {
+      cbs.describe = [&lib](std::string_view path) {
+        return lib.readMetadata(path).toStdString();
+      };
+      cbs.load = [&lib](std::string_view path, std::string_view metadata) {
+        lib.addMetadata(path, QByteArray(metadata.data(), metadata.size()));
+      };
+      cbs.id = score::uuids::toByteArray(lib.concreteKey().impl()).toStdString();
+    }
     for(const QString& ext : lib.acceptedFiles())
       w.registerWatch(ext.toStdString(), cbs);
   }
@@ -115,7 +128,13 @@ void ProcessesItemModel::rescan()
   if(!QDir{libpath}.exists())
     return;
 
-  QTimer::singleShot(1, this, [] { w.scan(); });
+  // The library folder is walked in the background: the folders and files
+  // which did not change since the previous session are known from the index.
+  const QString cache = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if(!cache.isEmpty() && QDir{}.mkpath(cache))
+    w.setIndexFile((cache + "/library-index.txt").toStdString());
+
+  QTimer::singleShot(1, this, [] { w.scanAsync(); });
 }
 
 void ProcessesItemModel::on_newPlugin(const Process::ProcessModelFactory& fact)
@@ -258,4 +277,30 @@ ProcessNode& addToLibrary(ProcessNode& parent, ProcessData&& data)
       parent, data.prettyName, nameSort, std::move(data), &parent);
 }
 
+QByteArray toMetadata(const Library::ProcessData& data)
+{
+  QByteArray res;
+  QDataStream s{&res, QIODevice::WriteOnly};
+  s.writeRawData(reinterpret_cast<const char*>(data.key.impl().data), 16);
+  s << data.prettyName << data.customData << data.author << data.description;
+  return res;
+}
+
+std::optional<Library::ProcessData> fromMetadata(const QByteArray& metadata)
+{
+  if(metadata.isEmpty())
+    return std::nullopt;
+
+  Library::ProcessData data;
+  QDataStream s{metadata};
+  score::uuid_t key;
+  if(s.readRawData(reinterpret_cast<char*>(key.data), 16) != 16)
+    return std::nullopt;
+  data.key = key;
+  s >> data.prettyName >> data.customData >> data.author >> data.description;
+  if(s.status() != QDataStream::Ok)
+    return std::nullopt;
+  return data;
+}
+
 }
@@ -39,6 +39,13 @@ using ProcessNode = TreeNode<ProcessData>;
 SCORE_PLUGIN_LIBRARY_EXPORT
 ProcessNode& addToLibrary(ProcessNode& parent, Library::ProcessData&& data);
 
+//! Binary form of a library entry, as cached in the library index.
+//! The icon is not saved.
+SCORE_PLUGIN_LIBRARY_EXPORT
+QByteArray toMetadata(const Library::ProcessData& data);
+SCORE_PLUGIN_LIBRARY_EXPORT
+std::optional<Library::ProcessData> fromMetadata(const QByteArray& metadata);
+
 class SCORE_PLUGIN_LIBRARY_EXPORT ProcessesItemModel
     : public TreeNodeBasedItemModel<ProcessNode>
     , public Nano::Observer
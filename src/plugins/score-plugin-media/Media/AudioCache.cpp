@@ -0,0 +1,242 @@
+#include "AudioCache.hpp"
+
+#include <Audio/Settings/Model.hpp>
+#include <Media/AudioDecoder.hpp>
+#include <Media/MediaFileHandle.hpp>
+
+#include <score/application/ApplicationContext.hpp>
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRandomGenerator>
+#include <QStandardPaths>
+#include <QThreadPool>
+
+#include <algorithm>
+
+namespace Media
+{
+namespace
+{
+bool writeEntry(const QString& path, const audio_array& data, int rate)
+{
+  // Written next to the entry then renamed, so that a file
+  // being written is never mmapped
+  const QString tmp = QStringLiteral("%1.%2.part")
+                          .arg(path)
+                          .arg(QRandomGenerator::global()->generate());
+  writeAudioArrayToFile(tmp, data, rate);
+  if(!QFile::rename(tmp, path))
+    QFile::remove(tmp);
+  return QFile::exists(path);
+}
+
+void evict(const QString& directory, int64_t maxSize)
+{
+  // The entries are touched when used:
+  // the oldest modification date is the least recently used
+  const auto entries = QDir{directory}.entryInfoList(
+      {QStringLiteral("*.wav")}, QDir::Files, QDir::Time | QDir::Reversed);
+
+  int64_t total = 0;
+  for(const auto& e : entries)
+    total += e.size();
+
+  for(const auto& e : entries)
+  {
+    if(total <= maxSize)
+      break;
+    if(QFile::remove(e.absoluteFilePath()))
+      total -= e.size();
+  }
+}
+
+int64_t maxSize()
+{
+  const auto& set = score::AppContext().settings<Audio::Settings::Model>();
+  return int64_t(set.getAudioCacheSize()) * 1024 * 1024;
+}
+}
+
+AudioCache::AudioCache()
+{
+  const auto cache = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  if(cache.isEmpty())
+    return;
+
+  QDir dir{cache};
+  if(dir.mkpath("audio"))
+    m_directory = dir.absoluteFilePath("audio");
+}
+
+AudioCache& AudioCache::instance() noexcept
+{
+  static AudioCache cache;
+  return cache;
+}
+
+bool AudioCache::isCompressed(const QString& file) noexcept
+{
+  static constexpr const char* uncompressed[]{"wav", "w64", "aif", "aiff"};
+  const auto suffix = QFileInfo{file}.suffix().toLower();
+  return std::none_of(std::begin(uncompressed), std::end(uncompressed), [&](auto s) {
+    return suffix == QLatin1String(s);
+  });
+}
+
+bool AudioCache::enabled() const noexcept
+{
+  return !m_directory.isEmpty() && maxSize() > 0;
+}
+
+QString AudioCache::key(const QString& file)
+{
+  QFileInfo info{file};
+  const auto mtime = QByteArray::number(info.lastModified().toMSecsSinceEpoch());
+  const QString id = QString::fromLatin1(mtime) + ':' + file;
+  if(auto it = m_keys.find(id); it != m_keys.end())
+    return *it;
+
+  QFile f{file};
+  if(!f.open(QIODevice::ReadOnly))
+    return {};
+
+  // The size and the ends of the file are enough to tell audio files apart,
+  // without reading every file of a project. The modification date
+  // covers the edits which would leave them unchanged.
+  static constexpr qint64 chunk = 65536;
+  const qint64 size = f.size();
+  QCryptographicHash h{QCryptographicHash::Sha1};
+  h.addData(QByteArray::number(size));
+  h.addData(mtime);
+  h.addData(f.read(chunk));
+  if(size > chunk)
+  {
+    f.seek(std::max(chunk, size - chunk));
+    h.addData(f.read(chunk));
+  }
+
+  const auto k = QString::fromLatin1(h.result().toHex());
+  m_keys.insert(id, k);
+  return k;
+}
+
+QString AudioCache::entry(const QString& key, int rate) const
+{
+  return QStringLiteral("%1/%2-%3.wav").arg(m_directory).arg(key).arg(rate);
+}
+
+QString AudioCache::find(const QString& file, int rate)
+{
+  if(!enabled())
+    return {};
+
+  const auto k = key(file);
+  if(k.isEmpty())
+    return {};
+
+  auto path = entry(k, rate);
+  QFile f{path};
+  if(!f.open(QIODevice::ReadWrite))
+    return {};
+
+  // Marks the entry as recently used
+  f.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+  return path;
+}
+
+void AudioCache::store(const QString& file, int rate, audio_handle data)
+{
+  if(!enabled() || !data || data->data.empty())
+    return;
+
+  const auto k = key(file);
+  if(k.isEmpty())
+    return;
+
+  auto path = entry(k, rate);
+  if(QFile::exists(path) || m_waiting.contains(path))
+    return;
+
+  write(std::move(path), rate, std::move(data));
+}
+
+void AudioCache::write(QString path, int rate, audio_handle data)
+{
+  QThreadPool::globalInstance()->start(
+      [dir = m_directory, max = maxSize(), path = std::move(path), rate,
+       data = std::move(data)] {
+    const bool ok = writeEntry(path, data->data, rate);
+    evict(dir, max);
+
+    QMetaObject::invokeMethod(
+        qApp, [path, ok] { AudioCache::instance().written(path, ok); },
+        Qt::QueuedConnection);
+  });
+}
+
+void AudioCache::written(const QString& path, bool ok)
+{
+  auto waiting = m_waiting.take(path);
+  for(auto& w : waiting)
+    if(w.context && w.done)
+      w.done(ok ? path : QString{});
+}
+
+bool AudioCache::storeNative(
+    const QString& file, int rate, QObject* context,
+    std::function<void(const QString&)> done)
+{
+  if(!enabled())
+    return false;
+
+  const auto k = key(file);
+  if(k.isEmpty())
+    return false;
+
+  auto path = entry(k, rate);
+  if(QFile::exists(path))
+  {
+    if(done)
+      QMetaObject::invokeMethod(
+          context, [done = std::move(done), path] { done(path); },
+          Qt::QueuedConnection);
+    return true;
+  }
+
+  // The same file may be requested by several processes while it is decoded
+  auto& waiting = m_waiting[path];
+  waiting.push_back({context, std::move(done)});
+  if(waiting.size() > 1)
+    return true;
+
+  auto info = probe(file);
+  if(!info || info->channels == 0)
+  {
+    QMetaObject::invokeMethod(
+        qApp, [this, path] { written(path, false); }, Qt::QueuedConnection);
+    return true;
+  }
+
+  // Decoded on the thread of the decoder, like any other file
+  auto hdl = std::make_shared<ossia::audio_data>();
+  auto dec = new AudioDecoder{rate};
+  QObject::connect(
+      dec, &AudioDecoder::finishedDecoding, qApp,
+      [this, dec, path, rate, hdl] {
+    const bool ok = dec->decoded > 0;
+    delete dec;
+    if(ok)
+      write(path, rate, hdl);
+    else
+      written(path, false);
+      },
+      Qt::QueuedConnection);
+  dec->decode(file, -1, hdl);
+  return true;
+}
+}
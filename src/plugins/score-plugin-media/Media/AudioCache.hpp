@@ -0,0 +1,78 @@
+#pragma once
+#include <Media/AudioArray.hpp>
+
+#include <QHash>
+#include <QPointer>
+#include <QString>
+
+#include <score_plugin_media_export.h>
+
+#include <functional>
+#include <vector>
+
+namespace Media
+{
+/**
+ * @brief On-disk cache of the decoded audio files
+ *
+ * The files which have to be decoded or resampled are saved once decoded as
+ * 32-bit float .wav files, which are then mmapped instead of being decoded
+ * again. The entries are addressed by a hash of the size, the modification
+ * date and the first and last 64 KiB of the source file, and by sample rate:
+ * hashing the whole content would mean reading every file of a project
+ * when loading it. The compressed files are decoded once
+ * at their native rate and stored, then resampled from the stored file:
+ * a change of the engine rate only costs a resampling.
+ *
+ * The size of the cache is bounded by the audio settings: the least recently
+ * used entries are removed beyond it.
+ *
+ * Only used from the main thread: the files are written in the background.
+ */
+class SCORE_PLUGIN_MEDIA_EXPORT AudioCache
+{
+public:
+  AudioCache();
+  static AudioCache& instance() noexcept;
+
+  //! The decoded file at this rate, or an empty string if not cached yet
+  QString find(const QString& file, int rate);
+
+  //! Saves the decoded data of a file
+  void store(const QString& file, int rate, audio_handle data);
+
+  /**
+   * @brief Decodes a file at its native rate and stores it
+   *
+   * done, if set, is called on the main thread unless context was destroyed,
+   * with the path of the entry, or an empty string if it could not be stored.
+   * Returns false if the cache is disabled, in which case done is not called.
+   */
+  bool storeNative(
+      const QString& file, int rate, QObject* context,
+      std::function<void(const QString&)> done);
+
+  static bool isCompressed(const QString& file) noexcept;
+
+private:
+  struct Waiting
+  {
+    QPointer<QObject> context;
+    std::function<void(const QString&)> done;
+  };
+
+  QString key(const QString& file);
+  QString entry(const QString& key, int rate) const;
+  bool enabled() const noexcept;
+  void write(QString path, int rate, audio_handle data);
+  void written(const QString& path, bool ok);
+
+  QString m_directory;
+
+  // Modification date and path of a file -> hash of its content
+  QHash<QString, QString> m_keys;
+
+  // Entries being decoded at their native rate -> who waits for them
+  QHash<QString, std::vector<Waiting>> m_waiting;
+};
+}
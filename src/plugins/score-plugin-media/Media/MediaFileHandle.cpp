@@ -87,7 +87,11 @@ void AudioFile::load(DecodingSetup opt)
       load_libav(rate);
       break;
     case DecodingMethod::Mmap:
-      load_drwav();
+      if(!load_drwav(m_file))
+      {
+        m_impl = Handle{};
+        on_mediaChanged();
+      }
       break;
     case DecodingMethod::Sndfile:
       load_sndfile();
@@ -189,6 +193,7 @@ std::optional<double> AudioFile::knownTempo() const noexcept
 AudioFileManager::AudioFileManager() noexcept
 {
   auto& audioSettings = score::GUIAppContext().settings<Audio::Settings::Model>();
+  // The files decoded at the previous rate stay in the AudioCache
   con(audioSettings, &Audio::Settings::Model::RateChanged, this,
       [this](auto newRate) { m_handles.clear(); });
 }
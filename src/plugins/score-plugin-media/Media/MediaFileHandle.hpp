@@ -230,8 +230,9 @@ public:
 
 private:
   void load_libav(int rate);
+  void decode_libav(const QString& source, int rate);
   void load_libav_stream();
-  void load_drwav();
+  bool load_drwav(const QString& path);
   void load_sndfile();
 
   friend class SoundComponentSetup;
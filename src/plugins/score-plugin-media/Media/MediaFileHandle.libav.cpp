@@ -1,3 +1,4 @@
+#include <Media/AudioCache.hpp>
 #include <Media/MediaFileHandle.hpp>
 #include <Media/RMSData.hpp>
 
@@ -12,82 +13,116 @@ void AudioFile::load_libav(int rate)
   // Loading with libav is used :
   // - when resampling is required
   // - when the file is not a .wav
-  auto ptr = std::make_shared<LibavReader>(rate);
-  auto& r = *ptr;
+  // The result is cached, thus this only happens once per file and rate
+  auto& cache = AudioCache::instance();
+  const bool cacheable = m_track == -1;
+  if(cacheable)
+  {
+    if(auto cached = cache.find(m_file, rate); !cached.isEmpty() && load_drwav(cached))
+      return;
+  }
+
   QFile f{m_file};
-  if(isSupported(f) || m_track != -1)
+  if(!isSupported(f) && m_track == -1)
   {
-    r.handle = std::make_shared<ossia::audio_data>();
+    m_impl = Handle{};
+    on_mediaChanged();
+    return;
+  }
 
-    auto info = probe(m_file);
-    if(!info)
+  auto info = probe(m_file);
+  if(!info)
+  {
+    m_impl = Handle{};
+    return;
+  }
+
+  m_rms->load(m_file, info->channels, rate, info->duration());
+
+  // Compressed files are decoded once at their native rate and stored,
+  // then resampled from the stored file, which is much faster than decoding
+  if(cacheable && info->fileRate != rate && AudioCache::isCompressed(m_file))
+  {
+    if(auto native = cache.find(m_file, info->fileRate); !native.isEmpty())
     {
-      m_impl = Handle{};
+      decode_libav(native, rate);
       return;
     }
 
-    m_rms->load(m_file, info->channels, rate, info->duration());
+    // The file is still decoded progressively at the requested rate so that
+    // it plays right away, while the native one is stored in the background
+    cache.storeNative(m_file, info->fileRate, this, {});
+  }
 
-    // TODO remove comment when rms works again if(!m_rms->exists())
-    {
-      connect(
-          &r.decoder, &AudioDecoder::newData, this,
-          [this] {
-        const auto& r = **m_impl.target<std::shared_ptr<LibavReader>>();
-        std::vector<tcb::span<const audio_sample>> samples;
-        auto& handle = r.handle->data;
-        const auto decoded = r.decoder.decoded;
-
-        for(auto& channel : handle)
-        {
-          samples.emplace_back(
-              channel.data(), tcb::span<ossia::audio_sample>::size_type(decoded));
-        }
-        m_rms->decode(samples);
-
-        on_newData();
-          },
-          Qt::QueuedConnection);
-
-      connect(
-          &r.decoder, &AudioDecoder::finishedDecoding, this,
-          [this] {
-        const auto& r = **m_impl.target<std::shared_ptr<LibavReader>>();
-        std::vector<tcb::span<const audio_sample>> samples;
-        auto& handle = r.handle->data;
-        auto decoded = r.decoder.decoded;
-
-        for(auto& channel : handle)
-        {
-          samples.emplace_back(
-              channel.data(), tcb::span<ossia::audio_sample>::size_type(decoded));
-        }
-        m_rms->decodeLast(samples);
-
-        m_fullyDecoded = true;
-        on_finishedDecoding();
-          },
-          Qt::QueuedConnection);
-    }
+  decode_libav(m_file, rate);
+}
 
-    r.decoder.decode(m_file, m_track, r.handle);
+void AudioFile::decode_libav(const QString& source, int rate)
+{
+  const bool cacheable = m_track == -1;
+  auto ptr = std::make_shared<LibavReader>(rate);
+  auto& r = *ptr;
+  r.handle = std::make_shared<ossia::audio_data>();
 
-    m_sampleRate = rate;
+  // TODO remove comment when rms works again if(!m_rms->exists())
+  {
+    connect(
+        &r.decoder, &AudioDecoder::newData, this,
+        [this] {
+      const auto& r = **m_impl.target<std::shared_ptr<LibavReader>>();
+      std::vector<tcb::span<const audio_sample>> samples;
+      auto& handle = r.handle->data;
+      const auto decoded = r.decoder.decoded;
 
-    QFileInfo fi{f};
+      for(auto& channel : handle)
+      {
+        samples.emplace_back(
+            channel.data(), tcb::span<ossia::audio_sample>::size_type(decoded));
+      }
+      m_rms->decode(samples);
 
-    // Assign pointers to the audio data
-    r.data.resize(r.handle->data.size());
-    for(std::size_t i = 0; i < r.handle->data.size(); i++)
-      r.data[i] = r.handle->data[i].data();
+      on_newData();
+        },
+        Qt::QueuedConnection);
 
-    m_fileName = fi.fileName();
-    m_impl = std::move(ptr);
-  }
-  else
-  {
-    m_impl = Handle{};
+    connect(
+        &r.decoder, &AudioDecoder::finishedDecoding, this,
+        [this, cacheable, rate] {
+      const auto& r = **m_impl.target<std::shared_ptr<LibavReader>>();
+      std::vector<tcb::span<const audio_sample>> samples;
+      auto& handle = r.handle->data;
+      auto decoded = r.decoder.decoded;
+
+      for(auto& channel : handle)
+      {
+        samples.emplace_back(
+            channel.data(), tcb::span<ossia::audio_sample>::size_type(decoded));
+      }
+      m_rms->decodeLast(samples);
+
+      if(cacheable)
+        AudioCache::instance().store(m_file, rate, r.handle);
+
+      m_fullyDecoded = true;
+      on_finishedDecoding();
+        },
+        Qt::QueuedConnection);
   }
+
+  r.decoder.decode(source, m_track, r.handle);
+
+  m_sampleRate = rate;
+
+  QFileInfo fi{m_file};
+
+  // Assign pointers to the audio data
+  r.data.resize(r.handle->data.size());
+  for(std::size_t i = 0; i < r.handle->data.size(); i++)
+    r.data[i] = r.handle->data[i].data();
+
+  m_fileName = fi.fileName();
+  m_impl = std::move(ptr);
+
   qDebug() << "AudioFileHandle::on_mediaChanged(): " << m_file;
   on_mediaChanged();
 }
@@ -0,0 +1,201 @@
+#include <Video/VideoEncoder.hpp>
+
+#if SCORE_HAS_LIBAV
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/pixdesc.h>
+#include <libswscale/swscale.h>
+}
+
+#include <QDebug>
+
+namespace Video
+{
+namespace
+{
+AVPixelFormat encoderPixelFormat(const AVCodec& codec)
+{
+  // Prefer the most widely decodable format when the encoder supports it
+  if(!codec.pix_fmts)
+    return AV_PIX_FMT_YUV420P;
+  for(auto p = codec.pix_fmts; *p != AV_PIX_FMT_NONE; ++p)
+    if(*p == AV_PIX_FMT_YUV420P)
+      return *p;
+  return codec.pix_fmts[0];
+}
+}
+
+VideoEncoder::VideoEncoder() noexcept { }
+
+VideoEncoder::~VideoEncoder() noexcept
+{
+  close();
+}
+
+bool VideoEncoder::open(
+    const std::string& file, int width, int height, double rate) noexcept
+{
+  close();
+
+  int err = avformat_alloc_output_context2(
+      &m_formatContext, nullptr, nullptr, file.c_str());
+  if(err < 0 || !m_formatContext)
+  {
+    qDebug() << "avformat_alloc_output_context2: " << av_to_string(err);
+    return false;
+  }
+
+  const AVCodec* codec = avcodec_find_encoder(m_formatContext->oformat->video_codec);
+  if(!codec)
+  {
+    qDebug() << "VideoEncoder: no video encoder for" << file.c_str();
+    free();
+    return false;
+  }
+
+  m_stream = avformat_new_stream(m_formatContext, nullptr);
+  m_codecContext = avcodec_alloc_context3(codec);
+  if(!m_stream || !m_codecContext)
+  {
+    free();
+    return false;
+  }
+
+  // Chroma subsampled formats need even dimensions
+  const AVRational frameRate = av_d2q(rate, 100000);
+  m_codecContext->width = width & ~1;
+  m_codecContext->height = height & ~1;
+  m_codecContext->time_base = av_inv_q(frameRate);
+  m_codecContext->framerate = frameRate;
+  m_codecContext->gop_size = 12;
+  m_codecContext->pix_fmt = encoderPixelFormat(*codec);
+  if(m_formatContext->oformat->flags & AVFMT_GLOBALHEADER)
+    m_codecContext->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+
+  err = avcodec_open2(m_codecContext, codec, nullptr);
+  if(err < 0)
+  {
+    qDebug() << "avcodec_open2: " << av_to_string(err);
+    free();
+    return false;
+  }
+
+  m_stream->time_base = m_codecContext->time_base;
+  avcodec_parameters_from_context(m_stream->codecpar, m_codecContext);
+
+  if(!(m_formatContext->oformat->flags & AVFMT_NOFILE))
+  {
+    err = avio_open(&m_formatContext->pb, file.c_str(), AVIO_FLAG_WRITE);
+    if(err < 0)
+    {
+      qDebug() << "avio_open: " << av_to_string(err);
+      free();
+      return false;
+    }
+  }
+
+  err = avformat_write_header(m_formatContext, nullptr);
+  if(err < 0)
+  {
+    qDebug() << "avformat_write_header: " << av_to_string(err);
+    free();
+    return false;
+  }
+
+  m_width = width;
+  m_height = height;
+  m_rescale = sws_getContext(
+      width, height, AV_PIX_FMT_RGBA, m_codecContext->width, m_codecContext->height,
+      m_codecContext->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+  m_packet = av_packet_alloc();
+
+  m_frame = av_frame_alloc();
+  m_frame->format = m_codecContext->pix_fmt;
+  m_frame->width = m_codecContext->width;
+  m_frame->height = m_codecContext->height;
+  if(!m_rescale || !m_packet || av_frame_get_buffer(m_frame, 0) < 0)
+  {
+    free();
+    return false;
+  }
+
+  m_pts = 0;
+  return true;
+}
+
+void VideoEncoder::addFrame(const uint8_t* rgba, int stride, bool flip) noexcept
+{
+  if(!m_frame)
+    return;
+
+  if(av_frame_make_writable(m_frame) < 0)
+    return;
+
+  // A negative stride reads the rows from the last one
+  const uint8_t* src = flip ? rgba + int64_t(m_height - 1) * stride : rgba;
+  const int srcStride = flip ? -stride : stride;
+  sws_scale(m_rescale, &src, &srcStride, 0, m_height, m_frame->data, m_frame->linesize);
+
+  m_frame->pts = m_pts++;
+  write(m_frame);
+}
+
+void VideoEncoder::write(AVFrame* frame) noexcept
+{
+  int ret = avcodec_send_frame(m_codecContext, frame);
+  if(ret < 0)
+  {
+    qDebug() << "avcodec_send_frame: " << av_to_string(ret);
+    return;
+  }
+
+  for(;;)
+  {
+    ret = avcodec_receive_packet(m_codecContext, m_packet);
+    if(ret == AVERROR(EAGAIN) || ret == AVERROR_EOF)
+      break;
+    if(ret < 0)
+    {
+      qDebug() << "avcodec_receive_packet: " << av_to_string(ret);
+      break;
+    }
+
+    av_packet_rescale_ts(m_packet, m_codecContext->time_base, m_stream->time_base);
+    m_packet->stream_index = m_stream->index;
+    av_interleaved_write_frame(m_formatContext, m_packet);
+  }
+}
+
+void VideoEncoder::close() noexcept
+{
+  if(m_frame)
+  {
+    // Flush the frames delayed by the encoder
+    write(nullptr);
+    av_write_trailer(m_formatContext);
+  }
+  free();
+}
+
+void VideoEncoder::free() noexcept
+{
+  if(m_rescale)
+  {
+    sws_freeContext(m_rescale);
+    m_rescale = nullptr;
+  }
+  av_frame_free(&m_frame);
+  av_packet_free(&m_packet);
+  avcodec_free_context(&m_codecContext);
+  if(m_formatContext)
+  {
+    if(!(m_formatContext->oformat->flags & AVFMT_NOFILE))
+      avio_closep(&m_formatContext->pb);
+    avformat_free_context(m_formatContext);
+    m_formatContext = nullptr;
+  }
+  m_stream = nullptr;
+}
+}
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+#include <Media/Libav.hpp>
+#if SCORE_HAS_LIBAV
+extern "C" {
+struct AVCodecContext;
+struct AVFormatContext;
+struct AVFrame;
+struct AVPacket;
+struct AVStream;
+struct SwsContext;
+}
+
+#include <score_plugin_media_export.h>
+
+#include <cstdint>
+#include <string>
+
+namespace Video
+{
+/**
+ * @brief Encodes RGBA frames to a video file
+ *
+ * The container is chosen from the file extension, and the codec is the
+ * default video codec of the container. The timestamps are given by
+ * the frame count and the rate, never by the wall clock, thus encoding
+ * the same frames always gives the same file.
+ */
+class SCORE_PLUGIN_MEDIA_EXPORT VideoEncoder
+{
+public:
+  VideoEncoder() noexcept;
+  ~VideoEncoder() noexcept;
+
+  VideoEncoder(const VideoEncoder&) = delete;
+  VideoEncoder& operator=(const VideoEncoder&) = delete;
+
+  bool open(const std::string& file, int width, int height, double rate) noexcept;
+  bool isOpen() const noexcept { return m_frame; }
+
+  //! The rows are given bottom to top if flip is set, as read back from GL
+  void addFrame(const uint8_t* rgba, int stride, bool flip) noexcept;
+
+  //! Writes the frames still in the encoder and the trailer of the file
+  void close() noexcept;
+
+  int64_t frames() const noexcept { return m_pts; }
+
+private:
+  void write(AVFrame* frame) noexcept;
+  void free() noexcept;
+
+  AVFormatContext* m_formatContext{};
+  AVCodecContext* m_codecContext{};
+  AVStream* m_stream{};
+  AVFrame* m_frame{};
+  AVPacket* m_packet{};
+  SwsContext* m_rescale{};
+  int m_width{};
+  int m_height{};
+  int64_t m_pts{};
+};
+}
+#endif
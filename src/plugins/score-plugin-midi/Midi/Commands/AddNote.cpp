@@ -100,9 +100,10 @@ ReplaceNotes::ReplaceNotes(
 void ReplaceNotes::undo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
-  model.notes.clear();
   model.setDuration(m_olddur);
 
+  // replace() deletes the previous notes and sends a single signal,
+  // instead of one removing() per note as clear() does.
   IdContainer<Note> new_notes;
   for(auto& note : m_old)
     new_notes.insert(new Note{note.first, note.second, &model});
@@ -114,7 +115,6 @@ void ReplaceNotes::undo(const score::DocumentContext& ctx) const
 void ReplaceNotes::redo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
-  model.notes.clear();
   model.setDuration(m_newdur);
 
   IdContainer<Note> new_notes;
@@ -59,11 +59,11 @@ RescaleMidi::RescaleMidi(const ProcessModel& model, double delta)
 void RescaleMidi::undo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
-  model.notes.clear();
+
+  IdContainer<Note> new_notes;
   for(auto& note : m_old)
-  {
-    model.notes.add(new Note{note.first, note.second, &model});
-  }
+    new_notes.insert(new Note{note.first, note.second, &model});
+  model.notes.replace(std::move(new_notes));
 }
 
 void RescaleMidi::redo(const score::DocumentContext& ctx) const
@@ -13,9 +13,13 @@ namespace Executor
 using midi_node = ossia::nodes::midi;
 static midi_node::note_set to_ossia(Component& c)
 {
-  midi_node::note_set notes;
   auto& element = c.process();
-  notes.reserve(element.notes.size());
+
+  // Convert into a plain vector first: inserting notes one by one in the
+  // sorted set is quadratic for large MIDI files, while a range insert
+  // sorts the whole batch once.
+  std::vector<ossia::nodes::note_data> vec;
+  vec.reserve(element.notes.size());
   for(const auto& n : element.notes)
   {
     auto data = n.noteData();
@@ -24,8 +28,12 @@ static midi_node::note_set to_ossia(Component& c)
       data.setStart(0.);
       data.setDuration(data.duration() + data.start());
     }
-    notes.insert(c.to_note(data));
+    vec.push_back(c.to_note(data));
   }
+
+  midi_node::note_set notes;
+  notes.reserve(vec.size());
+  notes.insert(vec.begin(), vec.end());
   return notes;
 }
 
@@ -47,15 +55,7 @@ Component::Component(
   element.notes.replaced.connect<&Component::on_notesReplaced>(this);
 
   for(auto& note : element.notes)
-  {
-    QObject::connect(
-        &note, &Note::noteChanged, this,
-        [&, midi, cur = to_note(note.noteData())]() mutable {
-      auto old = cur;
-      cur = to_note(note.noteData());
-      in_exec([old, cur, midi] { midi->update_note(old, cur); });
-        });
-  }
+    connectNote(note);
 
   QObject::connect(
       &element, &Midi::ProcessModel::notesChanged, this, &Component::on_notesReplaced);
@@ -63,31 +63,77 @@ Component::Component(
 
 Component::~Component() { }
 
-void Component::on_noteAdded(const Note& n)
+void Component::connectNote(const Note& n)
 {
-  auto midi = std::dynamic_pointer_cast<midi_node>(node);
-  in_exec([nd = to_note(n.noteData()), midi] { midi->add_note(nd); });
-
   QObject::connect(
-      &n, &Note::noteChanged, this, [&, midi, cur = to_note(n.noteData())]() mutable {
+      &n, &Note::noteChanged, this, [this, &n, cur = to_note(n.noteData())]() mutable {
         auto old = cur;
         cur = to_note(n.noteData());
-        in_exec([old, cur, midi] { midi->update_note(old, cur); });
+        on_noteChanged(old, cur);
       });
 }
 
+void Component::on_noteChanged(
+    const ossia::nodes::note_data& old, const ossia::nodes::note_data& cur)
+{
+  // Edits of many notes (moving a selection, rescaling...) are coalesced
+  // into a single message to the execution thread.
+  if(m_pendingUpdates.empty())
+  {
+    QMetaObject::invokeMethod(
+        this, [this] { flushNoteUpdates(); }, Qt::QueuedConnection);
+  }
+  m_pendingUpdates.push_back({old, cur});
+}
+
+void Component::flushNoteUpdates()
+{
+  if(m_pendingUpdates.empty())
+    return;
+
+  auto midi = std::dynamic_pointer_cast<midi_node>(node);
+  in_exec([updates = std::move(m_pendingUpdates), midi] {
+    for(const auto& [old, cur] : updates)
+      midi->update_note(old, cur);
+  });
+  m_pendingUpdates.clear();
+}
+
+void Component::on_noteAdded(const Note& n)
+{
+  flushNoteUpdates();
+
+  auto midi = std::dynamic_pointer_cast<midi_node>(node);
+  in_exec([nd = to_note(n.noteData()), midi] { midi->add_note(nd); });
+
+  connectNote(n);
+}
+
 void Component::on_noteRemoved(const Note& n)
 {
+  flushNoteUpdates();
+
   auto midi = std::dynamic_pointer_cast<midi_node>(node);
   in_exec([nd = to_note(n.noteData()), midi] { midi->remove_note(nd); });
 }
 
 void Component::on_notesReplaced()
 {
+  // The whole note set is sent again so pending updates are obsolete
+  m_pendingUpdates.clear();
+
   auto midi = std::dynamic_pointer_cast<midi_node>(node);
 
   in_exec([n = to_ossia(*this), midi]() mutable { midi->replace_notes(std::move(n)); });
+
+  // notesChanged keeps the same notes, replaced brings new ones
+  for(auto& note : process().notes)
+  {
+    QObject::disconnect(&note, &Note::noteChanged, this, nullptr);
+    connectNote(note);
+  }
 }
+
 ossia::nodes::note_data Component::to_note(const NoteData& n)
 {
   auto& cv_time = system().time;
@@ -7,10 +7,7 @@
 #include <ossia/dataflow/node_process.hpp>
 #include <ossia/detail/flat_set.hpp>
 #include <ossia/editor/scenario/time_process.hpp>
-namespace ossia::nodes
-{
-struct note_data;
-}
+#include <ossia/dataflow/nodes/midi.hpp>
 
 namespace Device
 {
@@ -36,6 +33,15 @@ public:
   void on_notesReplaced();
 
   ossia::nodes::note_data to_note(const NoteData& n);
+
+private:
+  void connectNote(const Midi::Note&);
+  void on_noteChanged(
+      const ossia::nodes::note_data& old, const ossia::nodes::note_data& cur);
+  void flushNoteUpdates();
+
+  std::vector<std::pair<ossia::nodes::note_data, ossia::nodes::note_data>>
+      m_pendingUpdates;
 };
 
 using ComponentFactory = ::Execution::ProcessComponentFactory_T<Component>;
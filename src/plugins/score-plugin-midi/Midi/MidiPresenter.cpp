@@ -72,6 +72,7 @@ Presenter::Presenter(
 
     m_notes.clear();
     m_selectedNotes.clear();
+    m_notes.reserve(model.notes.size());
 
     for(auto& note : model.notes)
     {
@@ -87,6 +88,7 @@ Presenter::Presenter(
   m_view->setRange(model.range().first, model.range().second);
   model.notes.added.connect<&Presenter::on_noteAdded>(this);
   model.notes.removing.connect<&Presenter::on_noteRemoving>(this);
+  model.notes.replacing.connect<&Presenter::on_notesReplacing>(this);
   model.notes.replaced.connect<&Presenter::on_notesReplaced>(this);
 
   connect(m_view, &View::doubleClicked, this, [&](QPointF pos) {
@@ -333,12 +335,23 @@ void Presenter::on_noteRemoving(const Note& n)
   }
 }
 
-void Presenter::on_notesReplaced()
+void Presenter::on_notesReplacing()
 {
-  m_selectedNotes.clear();
+  // The views and the selection refer to the notes which are about to be deleted
+  if(!m_selectedNotes.empty())
+  {
+    m_selectedNotes.clear();
+    context().context.selectionStack.pushNewSelection({});
+  }
+
   for(auto& n : m_notes)
     delete n;
   m_notes.clear();
+}
+
+void Presenter::on_notesReplaced()
+{
+  m_notes.reserve(this->model().notes.size());
 
   for(auto& note : this->model().notes)
   {
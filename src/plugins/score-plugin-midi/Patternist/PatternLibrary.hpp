@@ -38,6 +38,13 @@ class LibraryHandler final
   }
 
   void addPath(std::string_view path) override
+  {
+    addMetadata(path, readMetadata(path));
+  }
+
+  bool cachesMetadata() const noexcept override { return true; }
+
+  QByteArray readMetadata(std::string_view path) override
   {
     QFileInfo file{QString::fromUtf8(path.data(), path.length())};
     Library::ProcessData pdata;
@@ -45,7 +52,13 @@ class LibraryHandler final
     pdata.key = Metadata<ConcreteKey_k, Patternist::ProcessModel>::get();
     pdata.author = "Drum Patterns";
     pdata.customData = file.absoluteFilePath();
-    categories.add(file, std::move(pdata));
+    return Library::toMetadata(pdata);
+  }
+
+  void addMetadata(std::string_view path, const QByteArray& metadata) override
+  {
+    if(auto pdata = Library::fromMetadata(metadata))
+      categories.add(score::PathInfo{path}, std::move(*pdata));
   }
 };
 
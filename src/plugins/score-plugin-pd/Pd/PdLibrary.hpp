@@ -34,14 +34,26 @@ class LibraryHandler final
   }
 
   void addPath(std::string_view path) override
+  {
+    addMetadata(path, readMetadata(path));
+  }
+
+  bool cachesMetadata() const noexcept override { return true; }
+
+  QByteArray readMetadata(std::string_view path) override
   {
     QFileInfo file{QString::fromUtf8(path.data(), path.length())};
     Library::ProcessData pdata;
     pdata.prettyName = file.completeBaseName();
     pdata.key = Metadata<ConcreteKey_k, Pd::ProcessModel>::get();
     pdata.customData = [&] { return file.absoluteFilePath(); }();
+    return Library::toMetadata(pdata);
+  }
 
-    categories.add(file, std::move(pdata));
+  void addMetadata(std::string_view path, const QByteArray& metadata) override
+  {
+    if(auto pdata = Library::fromMetadata(metadata))
+      categories.add(score::PathInfo{path}, std::move(*pdata));
   }
 };
 
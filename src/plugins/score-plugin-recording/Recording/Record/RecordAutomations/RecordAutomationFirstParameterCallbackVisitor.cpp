@@ -14,11 +14,11 @@ void RecordAutomationFirstCallbackVisitor::operator()(std::array<float, 2> val)
   auto it = recorder.vec2_records.find(addr);
   SCORE_ASSERT(it != recorder.vec2_records.end());
 
-  const auto& proc_data = it->second;
+  auto& proc_data = it->second;
 
   const constexpr std::size_t N = 2;
   for(std::size_t i = 0; i < N; i++)
-    proc_data[i].segment.addPoint(0, val[i]);
+    proc_data[i].push(0, val[i], 0.);
 }
 
 void RecordAutomationFirstCallbackVisitor::operator()(std::array<float, 3> val)
@@ -26,11 +26,11 @@ void RecordAutomationFirstCallbackVisitor::operator()(std::array<float, 3> val)
   auto it = recorder.vec3_records.find(addr);
   SCORE_ASSERT(it != recorder.vec3_records.end());
 
-  const auto& proc_data = it->second;
+  auto& proc_data = it->second;
 
   const constexpr std::size_t N = 3;
   for(std::size_t i = 0; i < N; i++)
-    proc_data[i].segment.addPoint(0, val[i]);
+    proc_data[i].push(0, val[i], 0.);
 }
 
 void RecordAutomationFirstCallbackVisitor::operator()(std::array<float, 4> val)
@@ -38,11 +38,11 @@ void RecordAutomationFirstCallbackVisitor::operator()(std::array<float, 4> val)
   auto it = recorder.vec4_records.find(addr);
   SCORE_ASSERT(it != recorder.vec4_records.end());
 
-  const auto& proc_data = it->second;
+  auto& proc_data = it->second;
 
   const constexpr std::size_t N = 4;
   for(std::size_t i = 0; i < N; i++)
-    proc_data[i].segment.addPoint(0, val[i]);
+    proc_data[i].push(0, val[i], 0.);
 }
 
 void RecordAutomationFirstCallbackVisitor::handle_numeric(float newval)
@@ -50,8 +50,8 @@ void RecordAutomationFirstCallbackVisitor::handle_numeric(float newval)
   auto it = recorder.numeric_records.find(addr);
   SCORE_ASSERT(it != recorder.numeric_records.end());
 
-  const auto& proc_data = it->second;
-  proc_data.segment.addPoint(0, newval);
+  auto& proc_data = it->second;
+  proc_data.push(0, newval, 0.);
 }
 
 void RecordAutomationFirstCallbackVisitor::operator()(float f)
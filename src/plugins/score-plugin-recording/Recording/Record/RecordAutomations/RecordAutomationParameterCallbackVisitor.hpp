@@ -13,15 +13,20 @@ namespace Recording
  * if a message "/x 1" is received at t = 0,
  * if a message "/x 2" is received at t = 1,
  * then at t = 0.5 "/x" will still be 1
+ *
+ * With simplification enabled, changes smaller than the tolerance
+ * do not create a new step.
  */
 struct ParameterPolicy
 {
-  void operator()(const RecordData& proc, const TimeVal& msecs, double msec, float val)
+  void operator()(RecordData& proc, double msec, float val, double tolerance)
   {
-    auto last = proc.segment.points().rbegin();
-    proc.segment.addPoint(msec - 1, last->second);
-    proc.segment.addPoint(msec, val);
-    static_cast<Automation::ProcessModel*>(proc.curveModel.parent())->setDuration(msecs);
+    if(tolerance > 0. && std::abs(val - proc.lastValue) <= tolerance)
+      return;
+
+    const double last = proc.lastValue;
+    proc.push(msec - 1, last, 0.);
+    proc.push(msec, val, 0.);
   }
 };
 
@@ -35,10 +40,9 @@ struct ParameterPolicy
  */
 struct MessagePolicy
 {
-  void operator()(const RecordData& proc, const TimeVal& msecs, double msec, float val)
+  void operator()(RecordData& proc, double msec, float val, double tolerance)
   {
-    proc.segment.addPoint(msec, val);
-    static_cast<Automation::ProcessModel*>(proc.curveModel.parent())->setDuration(msecs);
+    proc.push(msec, val, tolerance);
   }
 };
 
@@ -55,12 +59,12 @@ struct RecordAutomationSubsequentCallbackVisitor
     auto it = recorder.vec2_records.find(addr);
     SCORE_ASSERT(it != recorder.vec2_records.end());
 
-    const auto& proc_data = it->second;
+    auto& proc_data = it->second;
 
     const constexpr std::size_t N = 2;
     for(std::size_t i = 0; i < N; i++)
     {
-      RecordingPolicy{}(proc_data[i], msecs, msec, val[i]);
+      RecordingPolicy{}(proc_data[i], msec, val[i], recorder.tolerance(proc_data[i]));
     }
   }
 
@@ -70,12 +74,12 @@ struct RecordAutomationSubsequentCallbackVisitor
     auto it = recorder.vec3_records.find(addr);
     SCORE_ASSERT(it != recorder.vec3_records.end());
 
-    const auto& proc_data = it->second;
+    auto& proc_data = it->second;
 
     const constexpr std::size_t N = 3;
     for(std::size_t i = 0; i < N; i++)
     {
-      RecordingPolicy{}(proc_data[i], msecs, msec, val[i]);
+      RecordingPolicy{}(proc_data[i], msec, val[i], recorder.tolerance(proc_data[i]));
     }
   }
 
@@ -85,12 +89,12 @@ struct RecordAutomationSubsequentCallbackVisitor
     auto it = recorder.vec4_records.find(addr);
     SCORE_ASSERT(it != recorder.vec4_records.end());
 
-    const auto& proc_data = it->second;
+    auto& proc_data = it->second;
 
     const constexpr std::size_t N = 4;
     for(std::size_t i = 0; i < N; i++)
     {
-      RecordingPolicy{}(proc_data[i], msecs, msec, val[i]);
+      RecordingPolicy{}(proc_data[i], msec, val[i], recorder.tolerance(proc_data[i]));
     }
   }
 
@@ -100,9 +104,9 @@ struct RecordAutomationSubsequentCallbackVisitor
     auto it = recorder.numeric_records.find(addr);
     SCORE_ASSERT(it != recorder.numeric_records.end());
 
-    const RecordData& proc_data = it->second;
+    RecordData& proc_data = it->second;
 
-    RecordingPolicy{}(proc_data, msecs, msec, newval);
+    RecordingPolicy{}(proc_data, msec, newval, recorder.tolerance(proc_data));
   }
 
   void operator()(float f) { handle_numeric(f); }
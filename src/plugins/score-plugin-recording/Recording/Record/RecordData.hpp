@@ -1,6 +1,11 @@
 #pragma once
 #include <State/Unit.hpp>
 
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <vector>
+
 namespace Scenario
 {
 class ProcessModel;
@@ -43,5 +48,73 @@ struct RecordData
   Curve::PointArraySegment& segment;
 
   State::Unit unit;
+
+  using point = std::pair<double, double>;
+
+  //! Points received since the last time they were committed to the segment
+  std::vector<point> pending;
+
+  //! Last point kept by the online simplification, and the latest received
+  //! point which may still be dropped if the next one is aligned with them.
+  std::optional<point> anchor;
+  std::optional<point> candidate;
+
+  double lastValue{};
+  double lastTime{};
+  bool dirty{};
+
+  /**
+   * @brief Adds a received point, decimating it if possible.
+   *
+   * With a tolerance > 0, a point is dropped when it lies within the tolerance
+   * of the line between its neighbours, so that a steady ramp or a constant
+   * value only keeps its end points.
+   */
+  void push(double x, double y, double tolerance)
+  {
+    lastValue = y;
+    lastTime = x;
+    dirty = true;
+
+    if(tolerance <= 0.)
+    {
+      flushCandidate();
+      pending.push_back({x, y});
+      anchor = point{x, y};
+      return;
+    }
+
+    if(!anchor)
+    {
+      pending.push_back({x, y});
+      anchor = point{x, y};
+      return;
+    }
+
+    if(candidate)
+    {
+      const auto [x0, y0] = *anchor;
+      const auto [x1, y1] = *candidate;
+      const double dx = x - x0;
+      const double interp = dx > 0. ? y0 + (y - y0) * (x1 - x0) / dx : y;
+      if(std::abs(interp - y1) > tolerance)
+      {
+        pending.push_back(*candidate);
+        anchor = candidate;
+      }
+    }
+    candidate = point{x, y};
+  }
+
+  //! Keeps the candidate point: used when the recording stops.
+  void flushCandidate()
+  {
+    if(candidate)
+    {
+      pending.push_back(*candidate);
+      anchor = candidate;
+      candidate.reset();
+    }
+  }
 };
 }
@@ -76,11 +76,30 @@ AutomationRecorder::AutomationRecorder(RecordContext& ctx)
     , m_settings{context.context.app.settings<Curve::Settings::Model>()}
 {
   connect(
-      this, &AutomationRecorder::parameterCallback_sig, this,
-      &AutomationRecorder::parameterCallback);
-  connect(
-      this, &AutomationRecorder::messageCallback_sig, this,
-      &AutomationRecorder::messageCallback);
+      &m_commitTimer, &QTimer::timeout, this, &AutomationRecorder::commitCaptured);
+}
+
+template <typename F>
+void AutomationRecorder::forEachRecord(F&& f)
+{
+  for(auto& recorded : numeric_records)
+    f(recorded.second);
+  for(auto& recorded : vec2_records)
+    for(auto& dat : recorded.second)
+      f(dat);
+  for(auto& recorded : vec3_records)
+    for(auto& dat : recorded.second)
+      f(dat);
+  for(auto& recorded : vec4_records)
+    for(auto& dat : recorded.second)
+      f(dat);
+}
+
+double AutomationRecorder::tolerance(RecordData& dat) const noexcept
+{
+  if(m_simplificationRatio <= 0.)
+    return 0.;
+  return (dat.segment.max() - dat.segment.min()) / m_simplificationRatio;
 }
 
 bool AutomationRecorder::setup(const Box& box, const RecordListening& recordListening)
@@ -105,6 +124,8 @@ bool AutomationRecorder::setup(const Box& box, const RecordListening& recordList
   //// Setup listening on the curves ////
   const auto curve_mode = m_settings.getCurveMode();
   m_recordingMode = curve_mode;
+  m_simplificationRatio
+      = m_settings.getSimplify() ? m_settings.getSimplificationRatio() : 0.;
   int i = 0;
   for(const auto& vec : recordListening)
   {
@@ -115,20 +136,16 @@ bool AutomationRecorder::setup(const Box& box, const RecordListening& recordList
     dev.addToListening(addresses[i]);
     // Add a custom callback. Note that the callback is executed from random devices threads,
     // not necessarily the main one...
-    if(curve_mode == Curve::Settings::Mode::Parameter)
-    {
-      dev.valueUpdated.connect<&AutomationRecorder::parameterCallback_sig>(*this);
-    }
-    else
-    {
-      dev.valueUpdated.connect<&AutomationRecorder::messageCallback_sig>(*this);
-    }
+    dev.valueUpdated.connect<&AutomationRecorder::capture>(*this);
 
     m_recordCallbackConnections.push_back(&dev);
 
     i++;
   }
 
+  m_commitTimer.setInterval(ReasonableUpdateInterval(count()));
+  m_commitTimer.start();
+
   return true;
 }
 
@@ -136,25 +153,25 @@ void AutomationRecorder::stop()
 {
   // Stop all the recording machinery
   auto msecs = context.time();
-  const auto curve_mode = m_recordingMode;
   for(const auto& dev : m_recordCallbackConnections)
   {
     if(dev)
     {
-      if(curve_mode == Curve::Settings::Mode::Parameter)
-      {
-        dev->valueUpdated.disconnect<&AutomationRecorder::parameterCallback_sig>(*this);
-      }
-      else
-      {
-        dev->valueUpdated.disconnect<&AutomationRecorder::messageCallback_sig>(*this);
-      }
+      dev->valueUpdated.disconnect<&AutomationRecorder::capture>(*this);
     }
   }
   m_recordCallbackConnections.clear();
 
   QApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
 
+  // Commit what is left in the capture queue
+  m_commitTimer.stop();
+  commitCaptured();
+  forEachRecord([this](RecordData& dat) {
+    dat.flushCandidate();
+    commit(dat);
+  });
+
   // Record and then stop
   if(!context.started())
   {
@@ -218,37 +235,53 @@ void AutomationRecorder::stop()
   }
 }
 
-void AutomationRecorder::messageCallback(
-    const State::Address& addr, const ossia::value& val)
+void AutomationRecorder::capture(const State::Address& addr, const ossia::value& val)
 {
-  using namespace std::chrono;
-  if(context.started())
-  {
-    val.apply(RecordAutomationSubsequentCallbackVisitor<MessagePolicy>{
-        *this, addr, context.time()});
-  }
-  else
-  {
-    firstMessageReceived();
-    context.start();
-    val.apply(RecordAutomationFirstCallbackVisitor{*this, addr});
-  }
+  m_captured.enqueue(CapturedValue{addr, val, std::chrono::steady_clock::now()});
 }
 
-void AutomationRecorder::parameterCallback(
-    const State::Address& addr, const ossia::value& val)
+void AutomationRecorder::commitCaptured()
 {
-  using namespace std::chrono;
-  if(context.started())
+  CapturedValue v;
+  while(m_captured.try_dequeue(v))
   {
-    val.apply(RecordAutomationSubsequentCallbackVisitor<ParameterPolicy>{
-        *this, addr, context.time()});
+    if(context.started())
+    {
+      if(m_recordingMode == Curve::Settings::Mode::Parameter)
+      {
+        v.value.apply(RecordAutomationSubsequentCallbackVisitor<ParameterPolicy>{
+            *this, v.address, context.timeAt(v.time)});
+      }
+      else
+      {
+        v.value.apply(RecordAutomationSubsequentCallbackVisitor<MessagePolicy>{
+            *this, v.address, context.timeAt(v.time)});
+      }
+    }
+    else
+    {
+      firstMessageReceived();
+      context.start(v.time);
+      v.value.apply(RecordAutomationFirstCallbackVisitor{*this, v.address});
+    }
   }
-  else
+
+  forEachRecord([this](RecordData& dat) { commit(dat); });
+}
+
+void AutomationRecorder::commit(RecordData& dat)
+{
+  if(!dat.dirty)
+    return;
+
+  dat.segment.addPoints(dat.pending);
+  dat.pending.clear();
+  dat.dirty = false;
+
+  if(dat.lastTime > 0.)
   {
-    firstMessageReceived();
-    context.start();
-    val.apply(RecordAutomationFirstCallbackVisitor{*this, addr});
+    static_cast<Automation::ProcessModel*>(dat.curveModel.parent())
+        ->setDuration(TimeVal::fromMsecs(dat.lastTime));
   }
 }
 
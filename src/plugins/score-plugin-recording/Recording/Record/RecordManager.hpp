@@ -7,6 +7,11 @@
 
 #include <score/tools/std/HashMap.hpp>
 
+#include <ossia/network/value/value.hpp>
+
+#include <QTimer>
+
+#include <concurrentqueue.h>
 #include <verdigris>
 namespace Curve
 {
@@ -39,7 +44,8 @@ public:
            + vec4_records.size() + list_records.size();
   }
 
-  void commit();
+  //! Tolerance of the online simplification of a recorded curve
+  double tolerance(RecordData& dat) const noexcept;
 
   score::hash_map<State::Address, RecordData> numeric_records;
   score::hash_map<State::Address, std::array<RecordData, 2>> vec2_records;
@@ -51,13 +57,24 @@ public:
   void firstMessageReceived() W_SIGNAL(firstMessageReceived);
 
 private:
-  void messageCallback_sig(const State::Address& addr, const ossia::value& val)
-      W_SIGNAL(messageCallback_sig, addr, val)
-  void parameterCallback_sig(const State::Address& addr, const ossia::value& val)
-      W_SIGNAL(parameterCallback_sig, addr, val)
+  struct CapturedValue
+  {
+    State::Address address;
+    ossia::value value;
+    std::chrono::steady_clock::time_point time;
+  };
 
-  void messageCallback(const State::Address& addr, const ossia::value& val);
-  void parameterCallback(const State::Address& addr, const ossia::value& val);
+  // Called from the device threads: only timestamps the value and
+  // queues it.
+  void capture(const State::Address& addr, const ossia::value& val);
+
+  // Called on the GUI thread at a fixed rate: applies the captured values to
+  // the curves in a single batch.
+  void commitCaptured();
+  void commit(RecordData& dat);
+
+  template <typename F>
+  void forEachRecord(F&& f);
 
   bool finish(
       State::AddressAccessor addr, const RecordData& dat, const TimeVal& msecs, bool,
@@ -66,6 +83,10 @@ private:
   Curve::Settings::Mode m_recordingMode{};
   std::vector<QPointer<Device::DeviceInterface>> m_recordCallbackConnections;
 
+  moodycamel::ConcurrentQueue<CapturedValue> m_captured;
+  QTimer m_commitTimer;
+  double m_simplificationRatio{};
+
   // TODO see this :
   // http://stackoverflow.com/questions/34596768/stdunordered-mapfind-using-a-type-different-than-the-key-type
 };
@@ -52,6 +52,13 @@ public:
     startTimer();
   }
 
+  //! Starts the recording at the time the first value was captured
+  void start(clock::time_point t)
+  {
+    firstValueTime = t;
+    startTimer();
+  }
+
   bool started() const
   {
     return firstValueTime.time_since_epoch() != clock::duration::zero();
@@ -61,6 +68,14 @@ public:
 
   double timeInDouble() const { return GetTimeDifferenceInDouble(firstValueTime); }
 
+  //! Time of a captured value relative to the start of the recording
+  TimeVal timeAt(clock::time_point t) const
+  {
+    using namespace std::chrono;
+    return TimeVal::fromMsecs(
+        duration_cast<microseconds>(t - firstValueTime).count() / 1000.);
+  }
+
   const score::DocumentContext& context;
   Scenario::ProcessModel& scenario;
   Explorer::DeviceExplorerModel& explorer;
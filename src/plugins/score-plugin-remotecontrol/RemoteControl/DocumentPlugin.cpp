@@ -20,6 +20,8 @@
 
 #include <QBuffer>
 
+#include <algorithm>
+
 #include <RemoteControl/DocumentPlugin.hpp>
 #include <RemoteControl/Scenario/Scenario.hpp>
 #include <RemoteControl/Settings/Model.hpp>
@@ -47,8 +49,17 @@ DocumentPlugin::DocumentPlugin(const score::DocumentContext& doc, QObject* paren
       },
       Qt::QueuedConnection);
 
-  // TODO put this as a setting instead
-  startTimer(100);
+  restartTimer(set.getUpdateRate());
+  con(set, &Settings::Model::UpdateRateChanged, this,
+      [this](int rate) { restartTimer(rate); });
+}
+
+void DocumentPlugin::restartTimer(int rate)
+{
+  if(m_timer != -1)
+    killTimer(m_timer);
+  m_timer = startTimer(
+      1000 / std::clamp(rate, Settings::min_update_rate, Settings::max_update_rate));
 }
 
 DocumentPlugin::~DocumentPlugin() { }
@@ -58,6 +69,8 @@ void DocumentPlugin::timerEvent(QTimerEvent* event)
   if(receiver.clients().size() == 0)
     return;
 
+  receiver.flushDeferredMessages();
+
   JSONReader r;
   r.stream.StartObject();
 
@@ -86,7 +99,14 @@ void DocumentPlugin::timerEvent(QTimerEvent* event)
   r.stream.EndArray();
   r.stream.EndObject();
 
-  receiver.sendMessage(r.toString());
+  // The clients already have this state
+  auto msg = r.toString();
+  if(msg == m_lastIntervals && receiver.connectionCount() == m_lastConnectionCount)
+    return;
+
+  receiver.sendMessage(msg);
+  m_lastIntervals = std::move(msg);
+  m_lastConnectionCount = receiver.connectionCount();
 }
 
 void DocumentPlugin::registerInterval(Scenario::IntervalModel& m)
@@ -364,6 +384,7 @@ void Receiver::unregisterSync(Path<Scenario::TimeSyncModel> tn)
 void Receiver::onNewConnection()
 {
   WSClient client{m_server.nextPendingConnection()};
+  m_connectionCount++;
 
   connect(
       client.socket, &QWebSocket::textMessageReceived, this,
@@ -450,6 +471,34 @@ void Receiver::sendMessage(const QString& str)
   }
 }
 
+void Receiver::sendMessageDeferred(
+    const QObject* source, std::function<QString()> message)
+{
+  auto& m = m_deferred[source];
+  m.source = source;
+  m.message = std::move(message);
+}
+
+void Receiver::flushDeferredMessages()
+{
+  if(m_deferred.empty())
+    return;
+
+  auto deferred = std::move(m_deferred);
+  m_deferred.clear();
+
+  if(m_clients.empty())
+    return;
+
+  for(auto& [source, m] : deferred)
+  {
+    if(!m.source)
+      continue;
+
+    sendMessage(m.message());
+  }
+}
+
 void Receiver::socketDisconnected()
 {
   QWebSocket* pClient = qobject_cast<QWebSocket*>(sender());
@@ -7,6 +7,7 @@
 #include <ossia/detail/flat_map.hpp>
 #include <ossia/detail/hash_map.hpp>
 
+#include <QPointer>
 #include <QtWebSockets/QWebSocket>
 #include <QtWebSockets/QWebSocketServer>
 
@@ -101,10 +102,23 @@ public:
 
   void sendMessage(const QString& str);
 
+  /**
+   * @brief Queues a message until the next update of the document plug-in.
+   *
+   * Messages queued for the same source replace each other: only the latest
+   * one is serialized, once, and sent to every client.
+   * Nothing is sent if the source has been destroyed in the meantime.
+   */
+  void sendMessageDeferred(const QObject* source, std::function<QString()> message);
+  void flushDeferredMessages();
+
   void socketDisconnected();
 
   const std::vector<WSClient>& clients() const noexcept { return m_clients; }
 
+  //! Incremented each time a client connects
+  int64_t connectionCount() const noexcept { return m_connectionCount; }
+
 private:
   void on_valueUpdated(const ::State::Address& addr, const ossia::value& v);
 
@@ -119,6 +133,14 @@ private:
   score::hash_map<::State::Address, WSClient> m_listenedAddresses;
 
   std::vector<std::pair<QObject*, Handler>> m_handlers;
+
+  struct DeferredMessage
+  {
+    QPointer<const QObject> source;
+    std::function<QString()> message;
+  };
+  ossia::hash_map<const QObject*, DeferredMessage> m_deferred;
+  int64_t m_connectionCount{};
 };
 
 class SCORE_PLUGIN_REMOTECONTROL_EXPORT DocumentPlugin : public score::DocumentPlugin
@@ -139,6 +161,7 @@ public:
 private:
   void create();
   void cleanup();
+  void restartTimer(int rate);
 
   struct IntervalData
   {
@@ -149,6 +172,11 @@ private:
 
   ossia::hash_map<int64_t, IntervalData> m_intervals;
 
+  // Last state sent to the clients, to skip sending it again if nothing changed
+  QString m_lastIntervals;
+  int64_t m_lastConnectionCount{};
+  int m_timer{-1};
+
   Interval* m_root{};
 };
 }
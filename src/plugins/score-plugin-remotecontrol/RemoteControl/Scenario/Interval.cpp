@@ -128,8 +128,12 @@ DefaultProcessComponent::DefaultProcessComponent(
 
     process().forEachControl([&](const Process::ControlInlet& inl, auto& val) {
       con(inl, &Process::ControlInlet::valueChanged, this, [this, &inl] {
-        RemoteMessages msgs{process()};
-        system().receiver.sendMessage(msgs.controlMessage(inl));
+        // Sent with the next update: a control changing many times between two
+        // updates is only serialized once
+        system().receiver.sendMessageDeferred(&inl, [&proc = process(), &inl] {
+          RemoteMessages msgs{proc};
+          return msgs.controlMessage(inl);
+        });
       });
     });
 
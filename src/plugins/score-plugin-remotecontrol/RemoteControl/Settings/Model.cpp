@@ -12,9 +12,10 @@ namespace Settings
 namespace Parameters
 {
 SETTINGS_PARAMETER_IMPL(Enabled){QStringLiteral("RemoteControl/Enabled"), false};
+SETTINGS_PARAMETER_IMPL(UpdateRate){QStringLiteral("RemoteControl/UpdateRate"), 10};
 static auto list()
 {
-  return std::tie(Enabled);
+  return std::tie(Enabled, UpdateRate);
 }
 }
 
@@ -24,5 +25,6 @@ Model::Model(QSettings& set, const score::ApplicationContext& ctx)
 }
 
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, Enabled)
+SCORE_SETTINGS_PARAMETER_CPP(int, Model, UpdateRate)
 }
 }
@@ -7,18 +7,25 @@ namespace RemoteControl
 {
 namespace Settings
 {
+//! Range of the update rate, in Hz, shared by the settings UI and the timer
+static constexpr int min_update_rate = 1;
+static constexpr int max_update_rate = 100;
+
 class SCORE_PLUGIN_REMOTECONTROL_EXPORT Model : public score::SettingsDelegateModel
 {
   W_OBJECT(Model)
   bool m_Enabled = false;
+  int m_UpdateRate = 10;
 
 public:
   Model(QSettings& set, const score::ApplicationContext& ctx);
 
   SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_REMOTECONTROL_EXPORT, bool, Enabled)
+  SCORE_SETTINGS_PARAMETER_HPP(SCORE_PLUGIN_REMOTECONTROL_EXPORT, int, UpdateRate)
 };
 
 SCORE_SETTINGS_PARAMETER(Model, Enabled)
+SCORE_SETTINGS_PARAMETER(Model, UpdateRate)
 
 }
 }
@@ -33,6 +33,8 @@ Presenter::Presenter(Model& m, View& v, QObject* parent)
     // initial value
     v.setEnabled(m.getEnabled());
   }
+
+  SETTINGS_PRESENTER(UpdateRate);
 }
 
 QString Presenter::settingsName()
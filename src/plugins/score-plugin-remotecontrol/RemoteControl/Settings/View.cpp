@@ -1,9 +1,11 @@
 #include "View.hpp"
 
 #include <score/widgets/FormWidget.hpp>
+#include <score/widgets/SignalUtils.hpp>
 
 #include <QCheckBox>
 #include <QFormLayout>
+#include <QSpinBox>
 
 #include <wobjectimpl.h>
 W_OBJECT_IMPL(RemoteControl::Settings::View)
@@ -36,8 +38,15 @@ View::View()
 
     lay->addRow(m_enabled);
   }
+
+  SETTINGS_UI_SPINBOX_SETUP("Update rate (Hz)", UpdateRate);
+  m_UpdateRate->setToolTip(
+      tr("Rate at which the state of the running score is sent to the clients."));
+  m_UpdateRate->setRange(min_update_rate, max_update_rate);
 }
 
+SETTINGS_UI_SPINBOX_IMPL(UpdateRate)
+
 void View::setEnabled(bool val)
 {
   switch(m_enabled->checkState())
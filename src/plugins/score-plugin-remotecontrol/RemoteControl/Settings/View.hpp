@@ -3,6 +3,7 @@
 
 #include <RemoteControl/Settings/Model.hpp>
 class QCheckBox;
+class QSpinBox;
 
 namespace score
 {
@@ -22,6 +23,8 @@ public:
 
   void enabledChanged(bool b) W_SIGNAL(enabledChanged, b);
 
+  SETTINGS_UI_SPINBOX_HPP(UpdateRate)
+
 private:
   QWidget* getWidget() override;
   score::FormWidget* m_widg{};
@@ -228,6 +228,17 @@ void TemporalIntervalView::paint(
   auto& painter = *p;
   const auto rect = boundingRect();
 
+  // When zoomed out the interval is only a few pixels wide:
+  // its details would not be visible anyway, so we only draw a plain line.
+  if(rect.width() < 4. && !m_execPing.running())
+  {
+    auto& skin = Process::Style::instance();
+    painter.setRenderHint(QPainter::Antialiasing, false);
+    painter.setPen(skin.IntervalSolidPen(this->intervalColor(skin)));
+    painter.drawLine(QPointF{0., 0.}, QPointF{rect.width(), 0.});
+    return;
+  }
+
   QPointF sceneDrawableTopLeft = view->mapToScene(-10, 0);
   QPointF sceneDrawableBottomRight
       = view->mapToScene(view->width() + 10, view->height() + 10);
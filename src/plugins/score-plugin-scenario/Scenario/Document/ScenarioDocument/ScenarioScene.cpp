@@ -9,7 +9,10 @@ namespace Scenario
 ScenarioScene::ScenarioScene(QObject* parent)
     : QGraphicsScene{parent}
 {
-  setItemIndexMethod(QGraphicsScene::NoIndex);
+  // Large documents have tens of thousands of items, most of them outside
+  // of the viewport: a spatial index keeps hit-testing and the computation of
+  // the exposed items logarithmic instead of linear in the item count.
+  setItemIndexMethod(QGraphicsScene::BspTreeIndex);
 }
 
 void ScenarioScene::helpEvent(QGraphicsSceneHelpEvent* event) { }
@@ -140,13 +140,7 @@ void ObjectItemModel::setupConnections()
     m_aliveMap.insert(obj, obj);
     if(auto cst = qobject_cast<const Scenario::IntervalModel*>(obj))
     {
-      cst->processes.added
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(*this);
-      cst->processes.removed
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(*this);
-
-      for(auto& proc : cst->processes)
-        m_aliveMap.insert(&proc, &proc);
+      connectProcesses(cst->processes);
     }
     else if(auto tn = qobject_cast<const Scenario::TimeSyncModel*>(obj))
     {
@@ -168,15 +162,7 @@ void ObjectItemModel::setupConnections()
             if(auto* sptr = scenar.findState(st))
             {
               m_aliveMap.insert(sptr, sptr);
-              sptr->stateProcesses.added
-                  .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(
-                      *this);
-              sptr->stateProcesses.removed
-                  .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(
-                      *this);
-
-              for(const auto& sp : sptr->stateProcesses)
-                m_aliveMap.insert(&sp, &sp);
+              connectProcesses(sptr->stateProcesses);
             }
           }
         }
@@ -195,13 +181,7 @@ void ObjectItemModel::setupConnections()
         if(auto* sptr = scenar.findState(st))
         {
           m_aliveMap.insert(sptr, sptr);
-          sptr->stateProcesses.added
-              .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(*this);
-          sptr->stateProcesses.removed
-              .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(*this);
-
-          for(const auto& sp : sptr->stateProcesses)
-            m_aliveMap.insert(&sp, &sp);
+          connectProcesses(sptr->stateProcesses);
         }
       }
     }
@@ -209,25 +189,117 @@ void ObjectItemModel::setupConnections()
     {
       auto& s = *st;
       m_aliveMap.insert(&s, &s);
-      s.stateProcesses.added
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(*this);
-      s.stateProcesses.removed
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(*this);
-
-      for(const auto& sp : s.stateProcesses)
-        m_aliveMap.insert(&sp, &sp);
+      connectProcesses(s.stateProcesses);
     }
 
     m_itemCon.push_back(connect(obj, &QObject::destroyed, this, [this, obj] {
-      m_root.removeOne(obj);
-      cleanConnections();
+      const int row = m_root.indexOf(obj);
+      if(row < 0)
+        return;
+
+      beginRemoveRows(QModelIndex{}, row, row);
+      m_root.removeAt(row);
+      m_aliveMap.remove(obj);
+      endRemoveRows();
+    }));
+  }
+}
 
-      beginResetModel();
-      endResetModel();
+void ObjectItemModel::connectProcesses(
+    const score::EntityMap<Process::ProcessModel, true>& procs)
+{
+  procs.added.connect<&ObjectItemModel::on_processAdded>(*this);
+  procs.removing.connect<&ObjectItemModel::on_processRemoving>(*this);
+  procs.removed.connect<&ObjectItemModel::on_processRemoved>(*this);
+  procs.replaced.connect<&ObjectItemModel::recompute<>>(*this);
 
-      setupConnections();
-    }));
+  for(const auto& proc : procs)
+    m_aliveMap.insert(&proc, &proc);
+}
+
+namespace
+{
+// Row of a process in its parent interval or state
+int processRow(const Process::ProcessModel& proc)
+{
+  const score::EntityMap<Process::ProcessModel, true>* procs{};
+  if(auto itv = qobject_cast<Scenario::IntervalModel*>(proc.parent()))
+    procs = &itv->processes;
+  else if(auto st = qobject_cast<Scenario::StateModel*>(proc.parent()))
+    procs = &st->stateProcesses;
+  else
+    return -1;
+
+  int row = 0;
+  for(const auto& p : *procs)
+  {
+    if(&p == &proc)
+      return row;
+    row++;
+  }
+  return -1;
+}
+}
+
+QModelIndex ObjectItemModel::objectIndex(const QObject* obj) const
+{
+  if(const int row = m_root.indexOf(obj); row >= 0)
+    return createIndex(row, 0, (void*)obj);
+
+  // States which are not at the root are children of their event
+  if(auto st = qobject_cast<const Scenario::StateModel*>(obj))
+  {
+    Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*st);
+    auto& ev = Scenario::parentEvent(*st, scenar);
+    auto it = ossia::find(ev.states(), st->id());
+    if(it != ev.states().end())
+      return createIndex(std::distance(ev.states().begin(), it), 0, (void*)st);
   }
+  return QModelIndex{};
+}
+
+void ObjectItemModel::on_processAdded(const Process::ProcessModel& proc)
+{
+  const auto parent = objectIndex(proc.parent());
+  const int row = processRow(proc);
+  if(!parent.isValid() || row < 0)
+  {
+    recompute();
+    return;
+  }
+
+  // The process is already in its parent container at this point
+  beginInsertRows(parent, row, row);
+  m_aliveMap.insert(&proc, &proc);
+  endInsertRows();
+
+  changed();
+}
+
+void ObjectItemModel::on_processRemoving(const Process::ProcessModel& proc)
+{
+  const auto parent = objectIndex(proc.parent());
+  const int row = processRow(proc);
+  if(!parent.isValid() || row < 0)
+    return;
+
+  beginRemoveRows(parent, row, row);
+  m_removingRows = true;
+}
+
+void ObjectItemModel::on_processRemoved(const Process::ProcessModel& proc)
+{
+  m_aliveMap.remove(&proc);
+  if(!m_removingRows)
+  {
+    recompute();
+    return;
+  }
+
+  m_removingRows = false;
+  endRemoveRows();
+
+  changed();
 }
 
 void ObjectItemModel::cleanConnections()
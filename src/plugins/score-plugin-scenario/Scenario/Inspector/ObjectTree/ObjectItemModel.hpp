@@ -1,5 +1,6 @@
 #pragma once
 #include <score/document/DocumentContext.hpp>
+#include <score/model/EntityMap.hpp>
 #include <score/plugins/panel/PanelDelegate.hpp>
 #include <score/plugins/panel/PanelDelegateFactory.hpp>
 #include <score/selection/SelectionDispatcher.hpp>
@@ -19,6 +20,10 @@
 #include <verdigris>
 class QToolButton;
 class QGraphicsSceneMouseEvent;
+namespace Process
+{
+class ProcessModel;
+}
 namespace Scenario
 {
 // TimeSync / event / state / state processes
@@ -63,6 +68,14 @@ private:
   void cleanConnections();
 
   bool isAlive(QObject* obj) const;
+  QModelIndex objectIndex(const QObject* obj) const;
+
+  // Processes added to or removed from a displayed interval or state
+  // only insert or remove the matching row
+  void on_processAdded(const Process::ProcessModel& proc);
+  void on_processRemoving(const Process::ProcessModel& proc);
+  void on_processRemoved(const Process::ProcessModel& proc);
+  void connectProcesses(const score::EntityMap<Process::ProcessModel, true>& procs);
 
   template <typename... Args>
   void recompute(Args&&...)
@@ -82,6 +95,7 @@ private:
 
   const score::DocumentContext& m_ctx;
   std::vector<QMetaObject::Connection> m_itemCon;
+  bool m_removingRows{};
 };
 
 class ObjectWidget final : public QTreeView
@@ -17,6 +17,8 @@
 #include <score/serialization/DataStreamVisitor.hpp>
 #include <score/tools/std/Optional.hpp>
 
+#include <ossia/detail/hash_map.hpp>
+
 #include <QDebug>
 
 template <typename T>
@@ -24,11 +26,100 @@ class Reader;
 
 namespace Scenario
 {
+namespace
+{
+// Subgraph moved when dragging a given timesync.
+struct DisplacementGraph
+{
+  struct Interval
+  {
+    Id<IntervalModel> interval;
+    Id<EventModel> startEvent;
+    Id<TimeSyncModel> startSync;
+    Id<TimeSyncModel> endSync;
+  };
+
+  const Scenario::ProcessModel* scenario{};
+  Id<TimeSyncModel> root;
+
+  // Used to detect that the structure of the scenario changed since init()
+  std::size_t timeSyncCount{};
+  std::size_t intervalCount{};
+  std::size_t stateCount{};
+
+  std::vector<Id<TimeSyncModel>> timeSyncs;
+  std::vector<Interval> intervals;
+
+  bool matches(const Scenario::ProcessModel& s, const Id<TimeSyncModel>& tn) const noexcept
+  {
+    return scenario == &s && root == tn && timeSyncCount == s.timeSyncs.size()
+           && intervalCount == s.intervals.size() && stateCount == s.states.size();
+  }
+
+  void build(const Scenario::ProcessModel& s, const Id<TimeSyncModel>& tn)
+  {
+    scenario = &s;
+    root = tn;
+    timeSyncCount = s.timeSyncs.size();
+    intervalCount = s.intervals.size();
+    stateCount = s.states.size();
+
+    timeSyncs.clear();
+    intervals.clear();
+
+    GoodOldDisplacementPolicy::getRelatedTimeSyncs(
+        const_cast<Scenario::ProcessModel&>(s), tn, timeSyncs);
+
+    // The intervals whose duration changes are the ones ending on a moved timesync
+    for(const auto& tn_id : timeSyncs)
+    {
+      for(const auto& ev_id : s.timeSync(tn_id).events())
+      {
+        for(const auto& st_id : s.event(ev_id).states())
+        {
+          const auto& st = s.states.at(st_id);
+          if(const auto& itv_id = st.previousInterval())
+          {
+            const auto& itv = s.intervals.at(*itv_id);
+            if(itv.graphal())
+              continue;
+
+            const auto& start_ev = Scenario::startEvent(itv, s);
+            intervals.push_back({*itv_id, start_ev.id(), start_ev.timeSync(), tn_id});
+          }
+        }
+      }
+    }
+  }
+
+  void clear() noexcept { scenario = nullptr; }
+};
+
+// Displacement only ever happens from the GUI thread, one drag at a time.
+DisplacementGraph& displacementGraph()
+{
+  static DisplacementGraph graph;
+  return graph;
+}
+}
+
+void GoodOldDisplacementPolicy::init(
+    Scenario::ProcessModel& scenario, const QVector<Id<TimeSyncModel>>& draggedElements)
+{
+  auto& graph = displacementGraph();
+  if(draggedElements.length() != 1)
+  {
+    graph.clear();
+    return;
+  }
+
+  graph.build(scenario, draggedElements.front());
+}
+
 void GoodOldDisplacementPolicy::computeDisplacement(
     Scenario::ProcessModel& scenario, const QVector<Id<TimeSyncModel>>& draggedElements,
     const TimeVal& deltaTime, ElementsProperties& elementsProperties)
 {
-  auto orig = elementsProperties;
   // this old behavior supports only the move of one timesync
   if(draggedElements.length() != 1)
   {
@@ -36,140 +127,106 @@ void GoodOldDisplacementPolicy::computeDisplacement(
     // move nothing, nothing to undo or redo
     return;
   }
-  else
-  {
-    const Id<TimeSyncModel>& firstTimeSyncMovedId = draggedElements.at(0);
-    std::vector<Id<TimeSyncModel>> timeSyncsToTranslate;
-    QObjectList processesToSave;
 
-    GoodOldDisplacementPolicy::getRelatedTimeSyncs(
-        scenario, firstTimeSyncMovedId, timeSyncsToTranslate);
+  const Id<TimeSyncModel>& firstTimeSyncMovedId = draggedElements.at(0);
+  auto& graph = displacementGraph();
+  if(!graph.matches(scenario, firstTimeSyncMovedId))
+    graph.build(scenario, firstTimeSyncMovedId);
 
-    // put each concerned timesync in modified elements and compute new values
-    for(const auto& curTimeSyncId : timeSyncsToTranslate)
-    {
-      auto& curTimeSync = scenario.timeSyncs.at(curTimeSyncId);
+  // The date of a timesync before this displacement started
+  auto oldDate = [&](const Id<TimeSyncModel>& id) {
+    auto it = elementsProperties.timesyncs.find(id);
+    return it != elementsProperties.timesyncs.end() ? it->second.oldDate
+                                                    : scenario.timeSyncs.at(id).date();
+  };
 
-      // if timesync NOT already in element properties, create new element
-      // properties and set the old date
-      auto tn_it = elementsProperties.timesyncs.find(curTimeSyncId);
-      if(tn_it == elementsProperties.timesyncs.end())
-      {
-        TimenodeProperties t;
-        t.oldDate = curTimeSync.date();
-        tn_it = elementsProperties.timesyncs.emplace(curTimeSyncId, std::move(t)).first;
-      }
+  // All the moved timesyncs are shifted by the same delta: first check that
+  // no interval would get a negative duration, before touching anything.
+  ossia::hash_set<Id<TimeSyncModel>> moved;
+  moved.reserve(graph.timeSyncs.size());
+  moved.insert(graph.timeSyncs.begin(), graph.timeSyncs.end());
 
-      // put the new date
-      auto& val = tn_it->second;
-      val.newDate = val.oldDate + deltaTime;
+  for(const auto& itv : graph.intervals)
+  {
+    const TimeVal date = moved.find(itv.startSync) != moved.end()
+                             ? oldDate(itv.startSync) + deltaTime
+                             : scenario.events.at(itv.startEvent).date();
+    const TimeVal endDate = oldDate(itv.endSync) + deltaTime;
+    if((endDate - date).impl < 0)
+      return;
+  }
+
+  // put each concerned timesync in modified elements and compute new values
+  for(const auto& curTimeSyncId : graph.timeSyncs)
+  {
+    // if timesync NOT already in element properties, create new element
+    // properties and set the old date
+    auto tn_it = elementsProperties.timesyncs.find(curTimeSyncId);
+    if(tn_it == elementsProperties.timesyncs.end())
+    {
+      TimenodeProperties t;
+      t.oldDate = scenario.timeSyncs.at(curTimeSyncId).date();
+      tn_it = elementsProperties.timesyncs.emplace(curTimeSyncId, std::move(t)).first;
     }
 
-    // beforeComputingIntervals:
-    // Make a list of the intervals that need to be resized
-    TimeVal maxNegativeDelta = TimeVal::zero();
-    for(const auto& curTimeSyncId : timeSyncsToTranslate)
+    // put the new date
+    auto& val = tn_it->second;
+    val.newDate = val.oldDate + deltaTime;
+  }
+
+  // Resize the intervals ending on a moved timesync
+  QObjectList processesToSave;
+  for(const auto& itv : graph.intervals)
+  {
+    auto& curInterval = scenario.intervals.at(itv.interval);
+
+    // if interval NOT already in element properties, create new
+    // element properties and set old values
+    auto cur_interval_it = elementsProperties.intervals.find(itv.interval);
+    if(cur_interval_it == elementsProperties.intervals.end())
     {
-      auto& curTimeSync = scenario.timeSync(curTimeSyncId);
+      IntervalProperties c{curInterval, false};
+      c.oldDate = curInterval.date();
+      c.oldDefault = curInterval.duration.defaultDuration();
+      c.oldMin = curInterval.duration.minDuration();
+      c.oldMax = curInterval.duration.maxDuration();
 
-      // each previous interval
-      for(const auto& ev_id : curTimeSync.events())
       {
-        const auto& ev = scenario.event(ev_id);
-        for(const auto& st_id : ev.states())
-        {
-          const auto& st = scenario.states.at(st_id);
-          if(const auto& optCurIntervalId = st.previousInterval())
-          {
-            auto curIntervalId = *optCurIntervalId;
-            auto& curInterval = scenario.intervals.at(curIntervalId);
-            if(curInterval.graphal())
-              continue;
-            // if timesync NOT already in element properties, create new
-            // element properties and set old values
-            auto cur_interval_it = elementsProperties.intervals.find(curIntervalId);
-            if(cur_interval_it == elementsProperties.intervals.end())
-            {
-              IntervalProperties c{curInterval, false};
-              c.oldDate = curInterval.date();
-              c.oldDefault = curInterval.duration.defaultDuration();
-              c.oldMin = curInterval.duration.minDuration();
-              c.oldMax = curInterval.duration.maxDuration();
-
-              {
-                const auto& date = Scenario::startEvent(curInterval, scenario).date();
-                const auto& endDate = Scenario::endEvent(curInterval, scenario).date();
-
-                TimeVal defaultDuration = endDate - date;
-                SCORE_ASSERT(defaultDuration == c.oldDefault);
-              }
-              cur_interval_it
-                  = elementsProperties.intervals.emplace(curIntervalId, std::move(c))
-                        .first;
-
-              for(auto& proc : curInterval.processes)
-                processesToSave.append(&proc);
-            }
-
-            auto& curIntervalStartEvent = Scenario::startEvent(curInterval, scenario);
-            auto& startTnodeId = curIntervalStartEvent.timeSync();
-
-            // compute default duration
-            TimeVal date;
-
-            // if prev tnode has moved take updated value else take existing
-            auto it = elementsProperties.timesyncs.find(startTnodeId);
-            if(it != elementsProperties.timesyncs.cend())
-            {
-              date = it->second.newDate;
-            }
-            else
-            {
-              date = curIntervalStartEvent.date();
-            }
-
-            const auto& endDate = elementsProperties.timesyncs[curTimeSyncId].newDate;
-
-            TimeVal newDefaultDuration = endDate - date;
-            if(newDefaultDuration < maxNegativeDelta)
-            {
-              maxNegativeDelta = newDefaultDuration;
-            }
-            TimeVal deltaBounds
-                = newDefaultDuration - curInterval.duration.defaultDuration();
-
-            auto& val = cur_interval_it->second;
-            val.newMin = curInterval.duration.minDuration() + deltaBounds;
-            val.newMax = curInterval.duration.maxDuration() + deltaBounds;
-
-            // nothing to do for now
-          }
-        }
-      }
+        const auto& date = scenario.events.at(itv.startEvent).date();
+        const auto& endDate = Scenario::endEvent(curInterval, scenario).date();
 
-      if(maxNegativeDelta.impl < 0)
-      {
-        elementsProperties = std::move(orig);
-        return;
-        /*
-        // TODO alternative:
-        const int64_t opposite{-maxNegativeDelta.impl};
-        for(auto it = elementsProperties.timesyncs.begin(); it != elementsProperties.timesyncs.end(); ++it)
-        {
-          it->second.newDate.impl += opposite;
-        }
-        elementsProperties.intervals.clear();
-        processesToSave.clear();
-        goto beforeComputingIntervals;
-        */
+        TimeVal defaultDuration = endDate - date;
+        SCORE_ASSERT(defaultDuration == c.oldDefault);
       }
-    }
+      cur_interval_it
+          = elementsProperties.intervals.emplace(itv.interval, std::move(c)).first;
 
-    if(!processesToSave.empty())
-    {
-      elementsProperties.cables = Dataflow::saveCables(
-          processesToSave, score::IDocument::documentContext(scenario));
+      for(auto& proc : curInterval.processes)
+        processesToSave.append(&proc);
     }
+
+    // if prev tnode has moved take updated value else take existing
+    TimeVal date;
+    auto it = elementsProperties.timesyncs.find(itv.startSync);
+    if(it != elementsProperties.timesyncs.cend())
+      date = it->second.newDate;
+    else
+      date = scenario.events.at(itv.startEvent).date();
+
+    const auto& endDate = elementsProperties.timesyncs[itv.endSync].newDate;
+
+    TimeVal newDefaultDuration = endDate - date;
+    TimeVal deltaBounds = newDefaultDuration - curInterval.duration.defaultDuration();
+
+    auto& val = cur_interval_it->second;
+    val.newMin = curInterval.duration.minDuration() + deltaBounds;
+    val.newMax = curInterval.duration.maxDuration() + deltaBounds;
+  }
+
+  if(!processesToSave.empty())
+  {
+    elementsProperties.cables = Dataflow::saveCables(
+        processesToSave, score::IDocument::documentContext(scenario));
   }
 }
 
@@ -177,37 +234,41 @@ void GoodOldDisplacementPolicy::getRelatedTimeSyncs(
     Scenario::ProcessModel& scenario, const Id<TimeSyncModel>& firstTimeSyncMovedId,
     std::vector<Id<TimeSyncModel>>& translatedTimeSyncs)
 {
-  if(firstTimeSyncMovedId.val() == Scenario::startId_val)
-    return;
+  ossia::hash_set<Id<TimeSyncModel>> visited;
+  visited.insert(translatedTimeSyncs.begin(), translatedTimeSyncs.end());
 
-  auto it = std::find(
-      translatedTimeSyncs.begin(), translatedTimeSyncs.end(), firstTimeSyncMovedId);
-  if(it == translatedTimeSyncs.end())
-  {
-    translatedTimeSyncs.push_back(firstTimeSyncMovedId);
-  }
-  else // timeSync already moved
+  // Depth-first traversal of the timesyncs reachable through non-graphal intervals
+  std::vector<Id<TimeSyncModel>> stack;
+  stack.push_back(firstTimeSyncMovedId);
+  while(!stack.empty())
   {
-    return;
-  }
+    const auto cur_timeSyncId = stack.back();
+    stack.pop_back();
 
-  const auto& cur_timeSync = scenario.timeSyncs.at(firstTimeSyncMovedId);
-  for(const auto& cur_eventId : cur_timeSync.events())
-  {
-    const auto& cur_event = scenario.events.at(cur_eventId);
+    if(cur_timeSyncId.val() == Scenario::startId_val)
+      continue;
+    if(!visited.insert(cur_timeSyncId).second)
+      continue; // timeSync already moved
+
+    translatedTimeSyncs.push_back(cur_timeSyncId);
 
-    for(const auto& state_id : cur_event.states())
+    const auto& cur_timeSync = scenario.timeSyncs.at(cur_timeSyncId);
+    for(const auto& cur_eventId : cur_timeSync.events())
     {
-      const auto& state = scenario.states.at(state_id);
-      if(const auto& cons = state.nextInterval())
+      const auto& cur_event = scenario.events.at(cur_eventId);
+
+      for(const auto& state_id : cur_event.states())
       {
-        const auto& itv = scenario.intervals.at(*cons);
-        if(Q_LIKELY(!itv.graphal()))
+        const auto& state = scenario.states.at(state_id);
+        if(const auto& cons = state.nextInterval())
         {
-          const auto& endStateId = itv.endState();
-          const auto& endTnId
-              = scenario.events.at(scenario.state(endStateId).eventId()).timeSync();
-          getRelatedTimeSyncs(scenario, endTnId, translatedTimeSyncs);
+          const auto& itv = scenario.intervals.at(*cons);
+          if(Q_LIKELY(!itv.graphal()))
+          {
+            const auto& endStateId = itv.endState();
+            stack.push_back(
+                scenario.events.at(scenario.state(endStateId).eventId()).timeSync());
+          }
         }
       }
     }
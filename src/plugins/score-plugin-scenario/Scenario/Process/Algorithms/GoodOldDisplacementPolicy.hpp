@@ -19,11 +19,16 @@ class ProcessModel;
 class GoodOldDisplacementPolicy
 {
 public:
+  /**
+   * @brief Computes the part of the scenario affected by the drag.
+   *
+   * The timesyncs following the dragged one and the intervals ending on them
+   * do not change while dragging: they are cached here so that
+   * computeDisplacement only has to update the dates.
+   */
   static void init(
       Scenario::ProcessModel& scenario,
-      const QVector<Id<TimeSyncModel>>& draggedElements)
-  {
-  }
+      const QVector<Id<TimeSyncModel>>& draggedElements);
 
   static void computeDisplacement(
       Scenario::ProcessModel& scenario,
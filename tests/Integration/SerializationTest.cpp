@@ -16,6 +16,7 @@
 #include <ossia/detail/flat_map.hpp>
 #include <ossia/detail/any_map.hpp>
 #include <unordered_map>
+#include <vector>
 
 
 static_assert(is_template<UuidKey<struct tag>>::value);
@@ -549,6 +550,99 @@ void JSONObjectWriter::write(crtp2& pt)
 }
 
 
+//////// Bulk serialization of numeric vectors ////////
+// More than the 512 elements converted at once by writeBulk / readBulk
+template <typename T>
+static std::vector<T> bulk_test_data()
+{
+  std::vector<T> v(1500);
+  for(std::size_t i = 0; i < v.size(); i++)
+  {
+    if constexpr(std::is_floating_point_v<T>)
+      v[i] = (i % 2 ? -1 : 1) * T(i) / T(7) + T(1e-30);
+    else
+      v[i] = T(i * 2654435761u) - T(i);
+  }
+  return v;
+}
+
+// The element-wise serialization used before writeBulk / readBulk
+template <typename T>
+static QByteArray write_elementwise(const std::vector<T>& v, QDataStream::ByteOrder order,
+    QDataStream::FloatingPointPrecision precision)
+{
+  QByteArray arr;
+  QDataStream s{&arr, QIODevice::WriteOnly};
+  s.setByteOrder(order);
+  s.setFloatingPointPrecision(precision);
+  for(const auto& e : v)
+    s << e;
+  return arr;
+}
+
+template <typename T>
+static std::vector<T> read_elementwise(const QByteArray& arr, std::size_t n,
+    QDataStream::ByteOrder order, QDataStream::FloatingPointPrecision precision)
+{
+  QDataStream s{arr};
+  s.setByteOrder(order);
+  s.setFloatingPointPrecision(precision);
+  std::vector<T> v(n);
+  for(auto& e : v)
+    s >> e;
+  return v;
+}
+
+template <typename T>
+static void check_bulk_roundtrip()
+{
+  const auto data = bulk_test_data<T>();
+  for(auto order : {QDataStream::BigEndian, QDataStream::LittleEndian})
+  {
+    for(auto precision : {QDataStream::SinglePrecision, QDataStream::DoublePrecision})
+    {
+      // The bulk writer produces the same bytes as the element-wise one...
+      QByteArray bulk;
+      {
+        QDataStream s{&bulk, QIODevice::WriteOnly};
+        s.setByteOrder(order);
+        s.setFloatingPointPrecision(precision);
+        score::serialization::writeBulk(s, data.data(), data.size());
+      }
+      const auto elementwise = write_elementwise(data, order, precision);
+      QCOMPARE(bulk, elementwise);
+
+      // ... and the bulk reader reads what the element-wise reader reads:
+      // doubles are narrowed to floats with the single precision
+      const auto expected
+          = read_elementwise<T>(elementwise, data.size(), order, precision);
+      if(!std::is_same_v<T, double> || precision == QDataStream::DoublePrecision)
+        QVERIFY(expected == data);
+
+      std::vector<T> res(data.size());
+      QDataStream s{bulk};
+      s.setByteOrder(order);
+      s.setFloatingPointPrecision(precision);
+      score::serialization::readBulk(s, res.data(), res.size());
+      QCOMPARE(s.status(), QDataStream::Ok);
+      QVERIFY(res == expected);
+
+      // Truncated data is reported
+      QDataStream truncated{bulk.left(bulk.size() / 2)};
+      truncated.setByteOrder(order);
+      truncated.setFloatingPointPrecision(precision);
+      score::serialization::readBulk(truncated, res.data(), res.size());
+      QCOMPARE(truncated.status(), QDataStream::ReadPastEnd);
+    }
+  }
+
+  // Through the DataStream visitors
+  std::vector<T> res;
+  DataStreamWriter wr{score::marshall<DataStream>(data)};
+  wr.writeTo(res);
+  QVERIFY(res == data);
+}
+
 class SerializationTest : public QObject
 {
   W_OBJECT(SerializationTest)
@@ -838,6 +932,14 @@ private:
   }
   W_SLOT(DataStreamTest)
 
+  void bulk_vector_test()
+  {
+    check_bulk_roundtrip<float>();
+    check_bulk_roundtrip<double>();
+    check_bulk_roundtrip<int>();
+  }
+  W_SLOT(bulk_vector_test)
+
 private:
   const ObjectPath test_path{{"IntervalModel", {}},
                              {"IntervalModel", 0},
@@ -0,0 +1,124 @@
+#include <score/serialization/DataStreamHelpers.hpp>
+
+#include <QByteArray>
+#include <QDataStream>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+// Compares the element-wise QDataStream serialization of numeric arrays
+// with the bulk path used by the DataStream visitors for std::vector and
+// boost::container::vector of arithmetic types.
+
+template <typename T>
+static std::vector<T> make_data(int64_t n)
+{
+  std::vector<T> v(n);
+  for(int64_t i = 0; i < n; i++)
+    v[i] = T(i % 1000) / T(7);
+  return v;
+}
+
+template <typename T>
+static void write_elementwise(benchmark::State& state)
+{
+  const auto data = make_data<T>(state.range(0));
+  QByteArray arr;
+  arr.reserve(data.size() * 8 + 16);
+  for(auto _ : state)
+  {
+    arr.resize(0);
+    QDataStream s{&arr, QIODevice::WriteOnly};
+    s << (int32_t)data.size();
+    for(const auto& e : data)
+      s << e;
+    benchmark::DoNotOptimize(arr.data());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+}
+
+template <typename T>
+static void write_bulk(benchmark::State& state)
+{
+  const auto data = make_data<T>(state.range(0));
+  QByteArray arr;
+  arr.reserve(data.size() * 8 + 16);
+  for(auto _ : state)
+  {
+    arr.resize(0);
+    QDataStream s{&arr, QIODevice::WriteOnly};
+    s << (int32_t)data.size();
+    score::serialization::writeBulk(s, data.data(), data.size());
+    benchmark::DoNotOptimize(arr.data());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+}
+
+template <typename T>
+static void read_elementwise(benchmark::State& state)
+{
+  const auto data = make_data<T>(state.range(0));
+  QByteArray arr;
+  {
+    QDataStream s{&arr, QIODevice::WriteOnly};
+    s << (int32_t)data.size();
+    for(const auto& e : data)
+      s << e;
+  }
+
+  std::vector<T> res;
+  for(auto _ : state)
+  {
+    QDataStream s{arr};
+    int32_t n{};
+    s >> n;
+    res.resize(n);
+    for(int32_t i = 0; i < n; i++)
+      s >> res[i];
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+}
+
+template <typename T>
+static void read_bulk(benchmark::State& state)
+{
+  const auto data = make_data<T>(state.range(0));
+  QByteArray arr;
+  {
+    QDataStream s{&arr, QIODevice::WriteOnly};
+    s << (int32_t)data.size();
+    for(const auto& e : data)
+      s << e;
+  }
+
+  std::vector<T> res;
+  for(auto _ : state)
+  {
+    QDataStream s{arr};
+    int32_t n{};
+    s >> n;
+    res.resize(n);
+    score::serialization::readBulk(s, res.data(), res.size());
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size() * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(write_elementwise, double)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(write_bulk, double)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(read_elementwise, double)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(read_bulk, double)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(write_elementwise, float)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(write_bulk, float)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(read_elementwise, float)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(read_bulk, float)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(write_elementwise, int32_t)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(write_bulk, int32_t)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(read_elementwise, int32_t)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(read_bulk, int32_t)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
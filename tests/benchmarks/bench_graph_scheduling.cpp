@@ -0,0 +1,182 @@
+#include <Execution/ExecutionThreads.hpp>
+
+#include <ossia/dataflow/execution_state.hpp>
+#include <ossia/dataflow/graph/graph_interface.hpp>
+#include <ossia/dataflow/graph_edge.hpp>
+#include <ossia/dataflow/graph_node.hpp>
+#include <ossia/dataflow/port.hpp>
+#include <ossia/network/value/value_conversion.hpp>
+
+#include <QString>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// Scaling of the serial and parallel graphs on synthetic workloads:
+// - wide: N independent chains of 4 nodes merged into a single sink,
+// - deep: a single chain of N nodes.
+// The second argument is the number of worker threads, 0 meaning serial.
+// Each node spins for a fixed amount of work, comparable to a small effect.
+//
+// The threads are placed like in score: SCORE_BENCH_CORES takes the same
+// core list as the execution settings (e.g. "2-9" or "node:0") and
+// SCORE_BENCH_REALTIME=1 requests SCHED_FIFO. The worker count is capped
+// to the selected cores as in score.
+
+namespace
+{
+const Execution::ThreadConfiguration& bench_threads()
+{
+  static const Execution::ThreadConfiguration conf = [] {
+    Execution::ThreadConfiguration c;
+    c.cores = Execution::parseCoreList(qEnvironmentVariable("SCORE_BENCH_CORES"));
+    c.realtime = qEnvironmentVariableIntValue("SCORE_BENCH_REALTIME") != 0;
+    return c;
+  }();
+  return conf;
+}
+
+struct busy_node final : ossia::nonowning_graph_node
+{
+  ossia::value_inlet in;
+  ossia::value_outlet out;
+  int work{};
+
+  explicit busy_node(int w)
+      : work{w}
+  {
+    m_inlets.push_back(&in);
+    m_outlets.push_back(&out);
+  }
+
+  void run(const ossia::token_request&, ossia::exec_state_facade) noexcept override
+  {
+    float acc = 0.f;
+    for(const auto& v : in->get_data())
+      acc += ossia::convert<float>(v.value);
+
+    for(int i = 0; i < work; i++)
+      acc = acc * 0.999f + std::sin(float(i));
+
+    out->write_value(acc, 0);
+  }
+
+  std::string label() const noexcept override { return "busy"; }
+};
+
+struct synthetic_graph
+{
+  std::shared_ptr<ossia::graph_interface> graph;
+  std::vector<std::shared_ptr<busy_node>> nodes;
+
+  explicit synthetic_graph(int threads)
+  {
+    const auto& conf = bench_threads();
+    ossia::graph_setup_options opt;
+    opt.parallel = threads > 0;
+    opt.parallel_threads = conf.workers(threads);
+    opt.scheduling = ossia::graph_setup_options::StaticFixed;
+    if(opt.parallel && (!conf.cores.empty() || conf.realtime))
+      Execution::runInWorkerConfiguration(
+          conf, [&] { graph = ossia::make_graph(opt); });
+    else
+      graph = ossia::make_graph(opt);
+  }
+
+  std::shared_ptr<busy_node> add(int work)
+  {
+    auto n = std::make_shared<busy_node>(work);
+    graph->add_node(n);
+    nodes.push_back(n);
+    return n;
+  }
+
+  void connect(const std::shared_ptr<busy_node>& src, const std::shared_ptr<busy_node>& sink)
+  {
+    graph->connect(graph->allocate_edge(
+        ossia::immediate_glutton_connection{}, src->root_outputs()[0],
+        sink->root_inputs()[0], src, sink));
+  }
+
+  void tick(ossia::execution_state& e)
+  {
+    ossia::token_request tk{};
+    tk.date = ossia::time_value{64};
+    for(auto& n : nodes)
+    {
+      n->requested_tokens.clear();
+      n->requested_tokens.push_back(tk);
+    }
+    graph->state(e);
+  }
+
+  ~synthetic_graph() { graph->clear(); }
+};
+
+constexpr int node_work = 2000;
+
+void run_graph(benchmark::State& state, synthetic_graph& g)
+{
+  ossia::execution_state e;
+  e.bufferSize = 64;
+  e.sampleRate = 48000;
+
+  // The benchmark thread plays the part of the audio thread
+  Execution::SavedThreadState previous;
+  previous.save(bench_threads());
+  Execution::configureTickThread(bench_threads());
+
+  for(auto _ : state)
+    g.tick(e);
+
+  previous.restore();
+
+  state.SetItemsProcessed(state.iterations() * g.nodes.size());
+}
+}
+
+static void graph_wide(benchmark::State& state)
+{
+  synthetic_graph g{int(state.range(1))};
+  auto sink = g.add(node_work);
+  for(int64_t i = 0; i < state.range(0); i++)
+  {
+    auto prev = g.add(node_work);
+    for(int k = 1; k < 4; k++)
+    {
+      auto n = g.add(node_work);
+      g.connect(prev, n);
+      prev = n;
+    }
+    g.connect(prev, sink);
+  }
+
+  run_graph(state, g);
+}
+BENCHMARK(graph_wide)
+    ->ArgsProduct({{4, 16, 64}, {0, 2, 4, 8, 16, 32, 64}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+static void graph_deep(benchmark::State& state)
+{
+  synthetic_graph g{int(state.range(1))};
+  auto prev = g.add(node_work);
+  for(int64_t i = 1; i < state.range(0); i++)
+  {
+    auto n = g.add(node_work);
+    g.connect(prev, n);
+    prev = n;
+  }
+
+  run_graph(state, g);
+}
+BENCHMARK(graph_deep)
+    ->ArgsProduct({{16, 64, 256}, {0, 2, 4, 8}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();